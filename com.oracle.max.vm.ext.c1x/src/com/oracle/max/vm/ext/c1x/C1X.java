@@ -124,6 +124,9 @@ public class C1X extends RuntimeCompiler.DefaultNameAdapter implements RuntimeCo
 
             map.put("UseStackMapTableLiveness", "Use liveness information derived from StackMapTable class file attribute.");
 
+            map.put("CountedLoopPollElisionLimit",
+                            "Omit the safepoint poll of a constant-bound counted loop if its trip count times its bytecode size is at most <n>.");
+
             for (String name : map.keySet()) {
                 try {
                     C1XOptions.class.getField(name);
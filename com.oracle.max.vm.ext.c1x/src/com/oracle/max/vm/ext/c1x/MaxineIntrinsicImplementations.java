@@ -22,6 +22,10 @@ package com.oracle.max.vm.ext.c1x;
 
 import static com.sun.max.vm.intrinsics.MaxineIntrinsicIDs.*;
 
+import java.lang.reflect.*;
+
+import sun.reflect.*;
+
 import com.oracle.max.cri.intrinsics.*;
 import com.sun.c1x.graph.*;
 import com.sun.c1x.intrinsics.*;
@@ -33,6 +37,10 @@ import com.sun.c1x.value.*;
 import com.sun.cri.bytecode.*;
 import com.sun.cri.ci.*;
 import com.sun.cri.ri.*;
+import com.sun.max.vm.*;
+import com.sun.max.vm.actor.holder.*;
+import com.sun.max.vm.actor.member.*;
+import com.sun.max.vm.jdk.*;
 import com.sun.max.vm.runtime.*;
 
 public class MaxineIntrinsicImplementations {
@@ -264,6 +272,31 @@ public class MaxineIntrinsicImplementations {
         }
     }
 
+    /**
+     * Replaces {@link Method#invoke} on a constant method with a direct call to the method's reflection stub, which
+     * the compiler can then inline down to a call of the method itself. This is only done for a public method of a
+     * public class, for which the access check performed by {@link Method#invoke} always succeeds. Any other call is
+     * compiled as it would be without the intrinsic.
+     */
+    public static class MethodInvokeIntrinsic implements C1XIntrinsicImpl {
+        @Override
+        public Value createHIR(GraphBuilder b, RiMethod target, Value[] args, boolean isStatic, FrameState stateBefore) {
+            assert args.length == 3;
+            Value receiver = args[0];
+            if (!MaxineVM.isHosted() && receiver.isConstant() && receiver.asConstant().isNonNull()) {
+                Method method = (Method) receiver.asConstant().asObject();
+                if (Modifier.isPublic(method.getModifiers()) && Modifier.isPublic(method.getDeclaringClass().getModifiers())) {
+                    MethodAccessor stub = JDK_sun_reflect_ReflectionFactory.methodAccessorFor(MethodActor.fromJava(method));
+                    VirtualMethodActor stubInvoke = ClassActor.fromJava(stub.getClass()).findVirtualMethodActor((MethodActor) target);
+                    b.genDirectCall(stubInvoke, new Value[] {new Constant(CiConstant.forObject(stub)), args[1], args[2]});
+                    return null;
+                }
+            }
+            b.genDirectCall((RiResolvedMethod) target, args);
+            return null;
+        }
+    }
+
     public static void initialize(IntrinsicImpl.Registry registry) {
         registry.add(LSB, new BitIntrinsic(LIROpcode.Lsb));
         registry.add(MSB, new BitIntrinsic(LIROpcode.Msb));
@@ -293,5 +326,7 @@ public class MaxineIntrinsicImplementations {
 
         registry.add(GET_TICKS, new GetTicksIntrinsic());
         registry.add(GET_CPU_ID, new GetCpuIDIntrinsic());
+
+        registry.add("java.lang.reflect.Method", "invoke", "(Ljava/lang/Object;[Ljava/lang/Object;)Ljava/lang/Object;", new MethodInvokeIntrinsic());
     }
 }
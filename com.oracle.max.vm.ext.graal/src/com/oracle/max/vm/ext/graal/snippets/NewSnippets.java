@@ -292,7 +292,7 @@ public class NewSnippets extends SnippetLowerings {
 
     @SNIPPET_SLOWPATH
     public static Object safeCreateMultiReferenceArray(ClassActor classActor, int[] lengths) {
-        return Snippets.createMultiReferenceArrayAtIndex(0, classActor, lengths);
+        return Snippets.createMultiReferenceArray(classActor, lengths);
     }
 
 
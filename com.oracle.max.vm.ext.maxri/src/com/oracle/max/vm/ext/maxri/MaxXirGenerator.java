@@ -2275,6 +2275,12 @@ public class MaxXirGenerator implements RiXirGenerator {
             if (l1 < 0 | l2 < 0) {
                 throw new NegativeArraySizeException();
             }
+            if (!MaxineVM.isHosted()) {
+                final Object array = Heap.createMultiArray(hub1, new int[] {l1, l2});
+                if (array != null) {
+                    return array;
+                }
+            }
             Object[] result = UnsafeCast.asObjectArray(createObjectArray(hub1, l1));
             DynamicHub hub2 = UnsafeCast.asDynamicHub(hub1.componentHub);
             for (int i1 = 0; i1 < l1; i1++) {
@@ -2287,6 +2293,12 @@ public class MaxXirGenerator implements RiXirGenerator {
             if (l1 < 0 | l2 < 0 | l3 < 0) {
                 throw new NegativeArraySizeException();
             }
+            if (!MaxineVM.isHosted()) {
+                final Object array = Heap.createMultiArray(hub1, new int[] {l1, l2, l3});
+                if (array != null) {
+                    return array;
+                }
+            }
             Object[] result = UnsafeCast.asObjectArray(createObjectArray(hub1, l1));
             DynamicHub hub2 = UnsafeCast.asDynamicHub(hub1.componentHub);
             DynamicHub hub3 = UnsafeCast.asDynamicHub(hub2.componentHub);
@@ -2307,6 +2319,12 @@ public class MaxXirGenerator implements RiXirGenerator {
                 }
             }
             ClassActor actor = Snippets.resolveClass(guard);
+            if (!MaxineVM.isHosted()) {
+                final Object array = Heap.createMultiArray(actor.dynamicHub(), lengths);
+                if (array != null) {
+                    return array;
+                }
+            }
             return recursiveNewMultiArray(0, actor, lengths);
         }
 
@@ -49,6 +49,8 @@
 #include "threads.h"
 #include "maxine.h"
 #include "memory.h"
+#include "perfMemory.h"
+#include "osResources.h"
 
 #if os_SOLARIS
 #include <sys/filio.h>
@@ -272,6 +274,11 @@ JVM_ActiveProcessorCount(void) {
         cpu_count = sysconf(_SC_NPROCESSORS_ONLN);
     }
 
+    // a CPU quota of the cgroup of the process (e.g. a container) restricts it further
+    int cpu_limit = osResources_processorLimit();
+    if (cpu_limit > 0 && cpu_limit < cpu_count) {
+        cpu_count = cpu_limit;
+    }
     return cpu_count;
 #elif os_DARWIN
     // Linux doesn't yet have a (official) notion of processor sets,
@@ -2335,8 +2342,7 @@ JVM_InitAgentProperties(JNIEnv *env, jobject agent_props) {
 
 jstring
 JVM_GetTemporaryDirectory(JNIEnv *env) {
-    UNIMPLEMENTED_WITH_ENV();
-    return 0;
+    return (*env)->NewStringUTF(env, perfMemory_temporaryDirectory());
 }
 
 /* Generics reflection support.
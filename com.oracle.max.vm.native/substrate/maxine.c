@@ -190,6 +190,7 @@ static void* loadSymbol(void* handle, const char* symbol) {
 #include <fcntl.h>
 #include <sys/socket.h>
 #include <sys/types.h>
+#include <sys/wait.h>
 #include <signal.h>
 
 #if os_DARWIN
@@ -411,6 +412,114 @@ void core_dump() {
 #endif
 }
 
+#if !os_MAXVE
+/**
+ * Tells whether a tracer is attached to the calling process. Only async-signal-safe functions are used
+ * as this is called in the child of a fork of a multi-threaded process.
+ */
+static int snapshot_is_traced(void) {
+#if os_LINUX
+    static const char key[] = "TracerPid:";
+    char buffer[1024];
+    ssize_t n;
+    ssize_t i;
+    int fd = open("/proc/self/status", O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    n = read(fd, buffer, sizeof(buffer) - 1);
+    close(fd);
+    if (n <= 0) {
+        return 0;
+    }
+    buffer[n] = '\0';
+    for (i = 0; i + (ssize_t) sizeof(key) - 1 <= n; i++) {
+        if (strncmp(buffer + i, key, sizeof(key) - 1) == 0) {
+            i += sizeof(key) - 1;
+            while (buffer[i] == ' ' || buffer[i] == '\t') {
+                i++;
+            }
+            return buffer[i] >= '1' && buffer[i] <= '9';
+        }
+    }
+#endif
+    return 0;
+}
+#endif
+
+/**
+ * Creates a copy of the VM process for inspection, leaving the VM running.
+ *
+ * The copy is a grandchild of the VM so that it is reaped by init rather than by the VM. It closes its
+ * file descriptors, so it doesn't hold on to the VM's files and sockets, moves to its own process group
+ * and stops itself with SIGSTOP.
+ * Once the intermediate child exits, the copy's process group is orphaned and the kernel sends it SIGHUP
+ * and SIGCONT. The copy therefore ignores SIGHUP and stops itself again whenever it is continued without
+ * a tracer attached. A debugger can attach to it at leisure; the copy exits when the debugger continues it.
+ * Where a tracer cannot be detected (other than Linux), the copy stays stopped until it is killed. Only the calling thread
+ * exists in the copy, so this must be called at a safepoint for the other threads' state to be found in memory.
+ *
+ * @return the process identifier of the stopped copy, or -1 if it could not be created
+ */
+int fork_snapshot() {
+#if os_MAXVE
+    return -1;
+#else
+    int fds[2];
+    struct rlimit nbr_files;
+    int maxfd = 1024;
+    pid_t child;
+    pid_t snapshot = -1;
+    struct sigaction action;
+
+    if (getrlimit(RLIMIT_NOFILE, &nbr_files) == 0 && nbr_files.rlim_cur != RLIM_INFINITY && nbr_files.rlim_cur < 65536) {
+        maxfd = (int) nbr_files.rlim_cur;
+    }
+    if (pipe(fds) != 0) {
+        return -1;
+    }
+    child = fork();
+    if (child == 0) {
+        // Only async-signal-safe functions from here on.
+        pid_t grandchild = fork();
+        if (grandchild == 0) {
+            int fd;
+            for (fd = 3; fd < maxfd; fd++) {
+                close(fd);
+            }
+            // Debuggers stop and resume the whole process group; keep the VM out of it.
+            setpgid(0, 0);
+#if os_LINUX && defined(PR_SET_PTRACER)
+            prctl(PR_SET_PTRACER, PR_SET_PTRACER_ANY, 0, 0, 0);
+#endif
+            // Survive the SIGHUP sent when the process group becomes orphaned.
+            memset(&action, 0, sizeof(action));
+            action.sa_handler = SIG_IGN;
+            sigaction(SIGHUP, &action, NULL);
+            // The SIGCONT sent along with it must not end the snapshot before a debugger attaches.
+            do {
+                kill(getpid(), SIGSTOP);
+            } while (!snapshot_is_traced());
+            _exit(0);
+        }
+        if (write(fds[1], &grandchild, sizeof(grandchild)) != sizeof(grandchild)) {
+            _exit(1);
+        }
+        _exit(0);
+    }
+    close(fds[1]);
+    if (child > 0) {
+        if (read(fds[0], &snapshot, sizeof(snapshot)) != sizeof(snapshot)) {
+            snapshot = -1;
+        }
+        while (waitpid(child, NULL, 0) < 0 && errno == EINTR) {
+        }
+    }
+    close(fds[0]);
+    return snapshot;
+#endif
+}
+
 void native_trap_exit(int code, Address address) {
     log_print("In ");
     log_print_symbol(address);
@@ -29,6 +29,7 @@ extern jlong native_currentTimeMillis(void);
 extern void *native_executablePath(void);
 extern void  native_exit(int code);
 extern void *native_environment(void);
+extern int   fork_snapshot(void);
 
 extern int maxine(int argc, char *argv[], char *executablePath);
 
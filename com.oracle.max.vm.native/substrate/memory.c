@@ -31,8 +31,159 @@
 #include "virtualMemory.h"
 #include "log.h"
 
+/*
+ * Native memory tracking.
+ *
+ * A tracked block is preceded by a header recording its size and category, so that the
+ * per-category totals can be adjusted when the block is freed or resized. Blocks allocated
+ * while tracking was off have no header. The addresses of the tracked blocks are kept in a
+ * hash set so that the two kinds of blocks are told apart without looking at memory that
+ * precedes an untracked block.
+ * The categories must be kept in sync with com.sun.max.memory.Memory.Category.
+ */
+#define MEMORY_CATEGORIES 8
+#define MEMORY_HEADER_SIZE 16
+
+typedef struct {
+    Size size;
+    jint category;
+} MemoryHeader;
+
+static volatile jlong categoryBytes[MEMORY_CATEGORIES];
+static volatile jlong categoryBlocks[MEMORY_CATEGORIES];
+
+/*
+ * Open addressing hash set of the addresses of the tracked blocks, guarded by a spin lock
+ * as it is used by allocations that may happen before any VM thread exists.
+ */
+#define TRACKED_EMPTY ((Address) 0)
+#define TRACKED_DELETED ((Address) 1)
+
+static Address *trackedTable;
+static size_t trackedCapacity;
+/* Number of slots that are not empty, i.e. holding a block or a deletion marker. */
+static size_t trackedUsed;
+/* Number of tracked blocks not yet freed; the set is only searched when non-zero. */
+static volatile size_t trackedBlocks;
+static volatile int trackedLock;
+
+static void tracked_lock(void) {
+    while (__sync_lock_test_and_set(&trackedLock, 1)) {
+        while (trackedLock) {
+        }
+    }
+}
+
+static void tracked_unlock(void) {
+    __sync_lock_release(&trackedLock);
+}
+
+static size_t tracked_hash(Address pointer) {
+    return (size_t) ((pointer >> 4) * 0x9E3779B97F4A7C15ULL);
+}
+
+static void tracked_insert(Address *table, size_t capacity, Address pointer) {
+    size_t i = tracked_hash(pointer) & (capacity - 1);
+    while (table[i] != TRACKED_EMPTY && table[i] != TRACKED_DELETED) {
+        i = (i + 1) & (capacity - 1);
+    }
+    table[i] = pointer;
+}
+
+/*
+ * Rehashes the set into a table that keeps the load factor at most 1/2, dropping the deletion markers.
+ */
+static int tracked_rehash(void) {
+    size_t capacity = trackedCapacity == 0 ? 1024 : trackedCapacity;
+    while (capacity < 4 * (trackedBlocks + 1)) {
+        capacity *= 2;
+    }
+    Address *table = (Address *) calloc(capacity, sizeof(Address));
+    size_t i;
+    if (table == NULL) {
+        return -1;
+    }
+    for (i = 0; i < trackedCapacity; i++) {
+        if (trackedTable[i] != TRACKED_EMPTY && trackedTable[i] != TRACKED_DELETED) {
+            tracked_insert(table, capacity, trackedTable[i]);
+        }
+    }
+    free(trackedTable);
+    trackedTable = table;
+    trackedCapacity = capacity;
+    trackedUsed = trackedBlocks;
+    return 0;
+}
+
+static int tracked_add(Address pointer) {
+    int result = 0;
+    tracked_lock();
+    if (2 * (trackedUsed + 1) > trackedCapacity) {
+        result = tracked_rehash();
+    }
+    if (result == 0) {
+        tracked_insert(trackedTable, trackedCapacity, pointer);
+        trackedUsed++;
+        trackedBlocks++;
+    }
+    tracked_unlock();
+    return result;
+}
+
+/*
+ * Removes a block from the set.
+ *
+ * @return whether the block was a tracked block
+ */
+static int tracked_remove(Address pointer) {
+    int found = 0;
+    if (trackedBlocks == 0 || pointer == 0) {
+        return 0;
+    }
+    tracked_lock();
+    if (trackedCapacity != 0) {
+        size_t i = tracked_hash(pointer) & (trackedCapacity - 1);
+        while (trackedTable[i] != TRACKED_EMPTY) {
+            if (trackedTable[i] == pointer) {
+                trackedTable[i] = TRACKED_DELETED;
+                trackedBlocks--;
+                found = 1;
+                break;
+            }
+            i = (i + 1) & (trackedCapacity - 1);
+        }
+    }
+    tracked_unlock();
+    return found;
+}
+
+static void account(jint category, jlong bytes, jlong blocks) {
+    __sync_fetch_and_add(&categoryBytes[category], bytes);
+    __sync_fetch_and_add(&categoryBlocks[category], blocks);
+}
+
+Address memory_allocate_category(Size size, jint category, jboolean zero, jboolean track) {
+    if (!track) {
+        return (Address) (zero ? calloc(1, (size_t) size) : malloc((size_t) size));
+    }
+    const size_t total = (size_t) size + MEMORY_HEADER_SIZE;
+    MemoryHeader *header = (MemoryHeader *) (zero ? calloc(1, total) : malloc(total));
+    if (header == NULL) {
+        return 0;
+    }
+    const Address block = ((Address) header) + MEMORY_HEADER_SIZE;
+    if (tracked_add(block) != 0) {
+        free((void *) header);
+        return 0;
+    }
+    header->size = size;
+    header->category = category;
+    account(category, size, 1);
+    return block;
+}
+
 Address memory_allocate(Size size) {
-    Address mem = (Address) calloc(1, (size_t) size);
+    Address mem = memory_allocate_category(size, 0, true, false);
     if (mem % sizeof(void *)) {
         log_println("MEMORY ALLOCATED NOT WORD-ALIGNED (size:%d at address:%x, void* size: %d)", size, mem, sizeof(void *));
     }
@@ -41,6 +192,27 @@ Address memory_allocate(Size size) {
 
 Address memory_reallocate(Address pointer, Size size) {
     Address mem;
+    if (tracked_remove(pointer)) {
+        MemoryHeader *header = (MemoryHeader *) (pointer - MEMORY_HEADER_SIZE);
+        const jint category = header->category;
+        const Size oldSize = header->size;
+        MemoryHeader *resized = (MemoryHeader *) realloc((void *) header, (size_t) size + MEMORY_HEADER_SIZE);
+        if (resized == NULL) {
+            /* The old block is still valid and still tracked. */
+            tracked_add(pointer);
+            return 0;
+        }
+        mem = ((Address) resized) + MEMORY_HEADER_SIZE;
+        if (tracked_add(mem) != 0) {
+            /* Cannot record the block: it stays usable but is no longer accounted for. */
+            account(category, -(jlong) oldSize, -1);
+            log_println("memory_reallocate: could not track block %p", mem);
+            return mem;
+        }
+        resized->size = size;
+        account(category, (jlong) size - (jlong) oldSize, 0);
+        return mem;
+    }
     if (pointer == 0) {
         mem = (Address) calloc(1, (size_t) size);
     } else {
@@ -50,6 +222,32 @@ Address memory_reallocate(Address pointer, Size size) {
 }
 
 jint memory_deallocate(Address pointer) {
+    if (tracked_remove(pointer)) {
+        MemoryHeader *header = (MemoryHeader *) (pointer - MEMORY_HEADER_SIZE);
+        account(header->category, -(jlong) header->size, -1);
+        free((void *) header);
+        return 0;
+    }
     free((void *) pointer);
     return 0;
 }
+
+jlong memory_category_bytes(jint category) {
+    return categoryBytes[category];
+}
+
+jlong memory_category_blocks(jint category) {
+    return categoryBlocks[category];
+}
+
+void memory_set(Address pointer, Size size, jint value) {
+    memset((void *) pointer, value, (size_t) size);
+}
+
+void memory_copy(Address from, Address to, Size size) {
+    memmove((void *) to, (void *) from, (size_t) size);
+}
+
+jint memory_compare(Address pointer1, Address pointer2, Size size) {
+    return memcmp((void *) pointer1, (void *) pointer2, (size_t) size);
+}
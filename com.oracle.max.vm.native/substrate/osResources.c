@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * Discovery of the resources granted to the VM process: the processors it may run on, the
+ * CPU quota and memory limit of the control group (cgroup v1 or v2) it belongs to, and the
+ * system load average.
+ *
+ * The cgroup files are looked up below the controller mount points, first at the path of the
+ * process' own cgroup and then at the mount root, which is where a container sees its own
+ * cgroup when it runs in a cgroup namespace.
+ */
+#include "os.h"
+
+#include <sys/types.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "word.h"
+#include "jni.h"
+#include "log.h"
+#include "osResources.h"
+
+#if os_LINUX
+
+#define CGROUP_ROOT "/sys/fs/cgroup"
+
+/* A cgroup v1 memory limit at or above this value means no limit was set. */
+#define CGROUP_V1_UNLIMITED ((jlong) 1 << 60)
+
+/*
+ * Reads a small pseudo file into a zero-terminated buffer.
+ */
+static int readFile(const char *path, char *buffer, size_t length) {
+    ssize_t n;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return -1;
+    }
+    n = read(fd, buffer, length - 1);
+    close(fd);
+    if (n <= 0) {
+        return -1;
+    }
+    buffer[n] = '\0';
+    return 0;
+}
+
+/*
+ * Gets the path of the cgroup of this process in the hierarchy that has the controller named
+ * by 'controller', or in the unified (v2) hierarchy if 'controller' is NULL.
+ */
+static int cgroupPath(const char *controller, char *path, size_t length) {
+    char buffer[4096];
+    char *line;
+    char *save;
+
+    if (readFile("/proc/self/cgroup", buffer, sizeof(buffer)) != 0) {
+        return -1;
+    }
+    /* Each line has the form <hierarchy-id>:<controller-list>:<path> */
+    for (line = strtok_r(buffer, "\n", &save); line != NULL; line = strtok_r(NULL, "\n", &save)) {
+        char *controllers = strchr(line, ':');
+        char *cgroup = controllers == NULL ? NULL : strchr(controllers + 1, ':');
+        if (cgroup == NULL) {
+            continue;
+        }
+        *cgroup++ = '\0';
+        controllers++;
+        if (controller == NULL) {
+            if (*controllers != '\0') {
+                continue;
+            }
+        } else {
+            char *name;
+            char *names;
+            int found = 0;
+            for (name = strtok_r(controllers, ",", &names); name != NULL; name = strtok_r(NULL, ",", &names)) {
+                if (strcmp(name, controller) == 0) {
+                    found = 1;
+                    break;
+                }
+            }
+            if (!found) {
+                continue;
+            }
+        }
+        return snprintf(path, length, "%s", cgroup) < (int) length ? 0 : -1;
+    }
+    return -1;
+}
+
+/*
+ * Reads the file 'name' of the cgroup at 'cgroup' below the mount point 'mount', falling back
+ * to the copy of the file at the mount root.
+ */
+static int readCgroupFile(const char *mount, const char *cgroup, const char *name, char *buffer, size_t length) {
+    char path[PATH_MAX];
+    if (cgroup != NULL && snprintf(path, sizeof(path), "%s%s/%s", mount, cgroup, name) < (int) sizeof(path)) {
+        if (readFile(path, buffer, length) == 0) {
+            return 0;
+        }
+    }
+    if (snprintf(path, sizeof(path), "%s/%s", mount, name) >= (int) sizeof(path)) {
+        return -1;
+    }
+    return readFile(path, buffer, length);
+}
+
+static int quotaToProcessors(jlong quota, jlong period) {
+    if (quota <= 0 || period <= 0) {
+        return 0;
+    }
+    return (int) ((quota + period - 1) / period);
+}
+
+static int cgroupProcessorLimit(void) {
+    char cgroup[PATH_MAX];
+    char buffer[128];
+    long long quota;
+    long long period;
+
+    /* cgroup v2: cpu.max holds "<quota> <period>", where the quota is "max" if there is none */
+    if (cgroupPath(NULL, cgroup, sizeof(cgroup)) == 0 &&
+        readCgroupFile(CGROUP_ROOT, cgroup, "cpu.max", buffer, sizeof(buffer)) == 0) {
+        if (strncmp(buffer, "max", 3) == 0 || sscanf(buffer, "%lld %lld", &quota, &period) != 2) {
+            return 0;
+        }
+        return quotaToProcessors(quota, period);
+    }
+
+    /* cgroup v1: the quota is -1 if there is none */
+    if (cgroupPath("cpu", cgroup, sizeof(cgroup)) == 0) {
+        const char *mount = CGROUP_ROOT "/cpu";
+        if (readCgroupFile(mount, cgroup, "cpu.cfs_quota_us", buffer, sizeof(buffer)) != 0) {
+            mount = CGROUP_ROOT "/cpu,cpuacct";
+            if (readCgroupFile(mount, cgroup, "cpu.cfs_quota_us", buffer, sizeof(buffer)) != 0) {
+                return 0;
+            }
+        }
+        if (sscanf(buffer, "%lld", &quota) != 1) {
+            return 0;
+        }
+        if (readCgroupFile(mount, cgroup, "cpu.cfs_period_us", buffer, sizeof(buffer)) != 0 || sscanf(buffer, "%lld", &period) != 1) {
+            return 0;
+        }
+        return quotaToProcessors(quota, period);
+    }
+    return 0;
+}
+
+static jlong cgroupMemoryLimit(void) {
+    char cgroup[PATH_MAX];
+    char buffer[128];
+    long long limit;
+
+    /* cgroup v2: memory.max holds the limit in bytes or "max" */
+    if (cgroupPath(NULL, cgroup, sizeof(cgroup)) == 0 &&
+        readCgroupFile(CGROUP_ROOT, cgroup, "memory.max", buffer, sizeof(buffer)) == 0) {
+        if (strncmp(buffer, "max", 3) == 0 || sscanf(buffer, "%lld", &limit) != 1 || limit <= 0) {
+            return 0;
+        }
+        return (jlong) limit;
+    }
+
+    /* cgroup v1: an unset limit reads as a huge page-aligned value */
+    if (cgroupPath("memory", cgroup, sizeof(cgroup)) == 0 &&
+        readCgroupFile(CGROUP_ROOT "/memory", cgroup, "memory.limit_in_bytes", buffer, sizeof(buffer)) == 0) {
+        if (sscanf(buffer, "%lld", &limit) != 1 || limit <= 0 || limit >= CGROUP_V1_UNLIMITED) {
+            return 0;
+        }
+        return (jlong) limit;
+    }
+    return 0;
+}
+
+#endif /* os_LINUX */
+
+/* The limits of a cgroup are not expected to change during the lifetime of the VM. */
+static int processorLimit = -1;
+static jlong memoryLimit = -1;
+
+int osResources_processorLimit(void) {
+    if (processorLimit < 0) {
+#if os_LINUX
+        processorLimit = cgroupProcessorLimit();
+#else
+        processorLimit = 0;
+#endif
+    }
+    return processorLimit;
+}
+
+jlong osResources_memoryLimit(void) {
+    if (memoryLimit < 0) {
+#if os_LINUX
+        memoryLimit = cgroupMemoryLimit();
+#else
+        memoryLimit = 0;
+#endif
+    }
+    return memoryLimit;
+}
+
+int osResources_loadAverage(double *loadavg, int nelems) {
+#if os_LINUX || os_DARWIN || os_SOLARIS
+    if (nelems >= 0 && nelems <= 3) {
+        return getloadavg(loadavg, nelems);
+    }
+#endif
+    return -1;
+}
+
+jlong osResources_processCpuTime(void) {
+#if os_LINUX || os_SOLARIS
+    struct timespec ts;
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) == 0) {
+        return ((jlong) ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    }
+#else
+    clock_t ticks = clock();
+    if (ticks != (clock_t) -1) {
+        return (jlong) ((double) ticks * 1000000000.0 / CLOCKS_PER_SEC);
+    }
+#endif
+    return -1;
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+#ifndef __osResources_h__
+#define __osResources_h__ 1
+
+#include "jni.h"
+
+/**
+ * Gets the number of processors granted by the CPU quota of the cgroup of this process, rounded up,
+ * or 0 if there is no quota.
+ */
+int osResources_processorLimit(void);
+
+/**
+ * Gets the memory limit in bytes of the cgroup of this process, or 0 if there is no limit.
+ */
+jlong osResources_memoryLimit(void);
+
+/**
+ * Stores up to 'nelems' (at most 3) of the system load averages over the last 1, 5 and 15 minutes,
+ * all taken from the same sample, in 'loadavg'. Returns the number of load averages stored or -1
+ * if they are not available.
+ */
+int osResources_loadAverage(double *loadavg, int nelems);
+
+/**
+ * Gets the CPU time consumed by all threads of this process in nanoseconds, or -1 if it is not available.
+ */
+jlong osResources_processCpuTime(void);
+
+#endif /* __osResources_h__ */
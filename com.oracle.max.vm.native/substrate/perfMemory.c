@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+
+/**
+ * The backing store of the performance data region published by com.sun.max.vm.management.PerfMemory.
+ *
+ * The region is a shared mapping of the file <tmp>/hsperfdata_<user>/<pid>, the location where
+ * jvmstat based tools look for the instrumentation of a local VM.
+ */
+#include "os.h"
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pwd.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "word.h"
+#include "jni.h"
+#include "log.h"
+#include "perfMemory.h"
+
+#ifndef O_NOFOLLOW
+#define O_NOFOLLOW 0
+#endif
+
+static const char *temporaryDirectory = "/tmp";
+
+/* The path of the backing store file of this VM, or the empty string if there is none. */
+static char backingStorePath[PATH_MAX];
+
+const char *perfMemory_temporaryDirectory(void) {
+    return temporaryDirectory;
+}
+
+static int userDirectoryPath(char *buffer, size_t length) {
+    struct passwd *pw = getpwuid(geteuid());
+    if (pw == NULL || pw->pw_name == NULL) {
+        return -1;
+    }
+    return snprintf(buffer, length, "%s/hsperfdata_%s", temporaryDirectory, pw->pw_name) < (int) length ? 0 : -1;
+}
+
+/*
+ * Creates the user directory if needed and checks that it is a real directory owned by the effective user,
+ * so that the backing store cannot be redirected through a planted symbolic link.
+ */
+static int makeUserDirectory(const char *path) {
+    struct stat st;
+    if (mkdir(path, S_IRWXU | S_IRGRP | S_IXGRP | S_IROTH | S_IXOTH) != 0 && errno != EEXIST) {
+        return -1;
+    }
+    if (lstat(path, &st) != 0 || !S_ISDIR(st.st_mode) || st.st_uid != geteuid()) {
+        return -1;
+    }
+    return 0;
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_sun_max_vm_management_PerfMemory_nativeCreate(JNIEnv *env, jclass c, jlong size) {
+    char directory[PATH_MAX];
+    char path[PATH_MAX];
+    void *result;
+    int fd;
+
+    if (userDirectoryPath(directory, sizeof(directory)) != 0 || makeUserDirectory(directory) != 0) {
+        return 0;
+    }
+    if (snprintf(path, sizeof(path), "%s/%d", directory, (int) getpid()) >= (int) sizeof(path)) {
+        return 0;
+    }
+    /* A file left behind by a dead process that had the same pid. */
+    unlink(path);
+    fd = open(path, O_RDWR | O_CREAT | O_TRUNC | O_NOFOLLOW, S_IRUSR | S_IWUSR);
+    if (fd < 0) {
+        return 0;
+    }
+    if (ftruncate(fd, (off_t) size) != 0) {
+        close(fd);
+        unlink(path);
+        return 0;
+    }
+    result = mmap(0, (size_t) size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (result == MAP_FAILED) {
+        unlink(path);
+        return 0;
+    }
+    strcpy(backingStorePath, path);
+    return (jlong) (Address) result;
+}
+
+/*
+ * Unlinks the backing store file. The mapping is left in place as other threads may still update counters.
+ */
+JNIEXPORT void JNICALL
+Java_com_sun_max_vm_management_PerfMemory_nativeRemoveBackingStore(JNIEnv *env, jclass c) {
+    if (backingStorePath[0] != '\0') {
+        unlink(backingStorePath);
+        backingStorePath[0] = '\0';
+    }
+}
+
+JNIEXPORT jint JNICALL
+Java_com_sun_max_vm_management_PerfMemory_nativeProcessId(JNIEnv *env, jclass c) {
+    return (jint) getpid();
+}
+
+JNIEXPORT jstring JNICALL
+Java_com_sun_max_vm_management_PerfMemory_nativeTemporaryDirectory(JNIEnv *env, jclass c) {
+    return (*env)->NewStringUTF(env, temporaryDirectory);
+}
+
+/*
+ * Maps the backing store of another VM read-only.
+ */
+JNIEXPORT jlong JNICALL
+Java_com_sun_max_vm_management_PerfMemory_nativeAttach(JNIEnv *env, jclass c, jstring path, jlong size) {
+    const char *cpath = (*env)->GetStringUTFChars(env, path, NULL);
+    void *result;
+    int fd;
+
+    if (cpath == NULL) {
+        return 0;
+    }
+    fd = open(cpath, O_RDONLY | O_NOFOLLOW);
+    (*env)->ReleaseStringUTFChars(env, path, cpath);
+    if (fd < 0) {
+        return 0;
+    }
+    result = mmap(0, (size_t) size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    return result == MAP_FAILED ? 0 : (jlong) (Address) result;
+}
+
+JNIEXPORT void JNICALL
+Java_com_sun_max_vm_management_PerfMemory_nativeDetach(JNIEnv *env, jclass c, jlong address, jlong size) {
+    munmap((void *) (Address) address, (size_t) size);
+}
@@ -31,7 +31,7 @@ LIB = jvm
 
 SOURCES = c.c condition.c log.c image.c $(ISA).c jni.c jvm.c maxine.c memory.c mutex.c \
           relocation.c dataio.c snippet.c threads.c threadLocals.c time.c trap.c \
-          virtualMemory.c jnitests.c sync.c signal.c jmm.c jvmti.c barrier.c
+          virtualMemory.c jnitests.c sync.c signal.c jmm.c jvmti.c barrier.c perfMemory.c osResources.c
 
 TARGETOS ?= $(shell uname -s)
 ifeq ($(TARGETOS),Linux)
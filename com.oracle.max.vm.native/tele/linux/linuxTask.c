@@ -33,6 +33,8 @@
 #include <sys/wait.h>
 #include <sys/time.h>
 #include <sys/prctl.h>
+#include <sys/uio.h>
+#include <limits.h>
 
 #include "log.h"
 #include "ptrace.h"
@@ -58,6 +60,36 @@ typedef struct user_regs_struct user_regs_structure;
  * task stopping/suspension. */
 static sigset_t _caughtSignals;
 
+/* The hardware watchpoints of the traced process. The debug registers are per task, so these
+ * are installed in every task of the process, including tasks created after activation. */
+static PtraceWatchSlot _watchSlots[PTRACE_MAX_WATCH_SLOTS];
+
+/* The region of the Inspector watchpoint occupying each slot in '_watchSlots'. A region
+ * that is not suitably aligned or is larger than 8 bytes occupies several slots. */
+static struct {
+    Address start;
+    Size size;
+} _watchRegions[PTRACE_MAX_WATCH_SLOTS];
+
+/* The number of hardware watchpoint slots or -1 if it has not yet been determined. */
+static int _watchSlotCount = -1;
+
+/* The number of slots in '_watchSlots' that are in use. */
+static int _watchSlotsInUse = 0;
+
+/* The slot hit by a task in the current stop or -1 if no task stopped at a watchpoint. */
+static int _watchSlotHit = -1;
+
+/**
+ * Installs the current hardware watchpoints in a stopped task.
+ */
+static boolean task_install_watchpoints(pid_t tid) {
+    if (_watchSlotCount <= 0) {
+        return true;
+    }
+    return ptrace_set_watch_slots(tid, _watchSlots, _watchSlotCount);
+}
+
 /**
  * Waits for a newly started thread to stop (via a SIGSTOP), configures it for ptracing
  * and resumes the new thread as well as the thread that started it (which is currently
@@ -87,6 +119,11 @@ static void task_attach_ptrace_to_new_task(int newTid, int starterTid) {
 
     ptrace(PT_SETOPTIONS, newTid, 0, PTRACE_O_TRACECLONE | PTRACE_O_TRACEEXIT);
 
+    /* Debug registers are not inherited by a cloned task. */
+    if (_watchSlotsInUse > 0 && !task_install_watchpoints(newTid)) {
+        log_println("Could not install hardware watchpoints in new task %d", newTid);
+    }
+
     tele_log_println("Resuming tasks %d and %d", newTid, starterTid);
     ptrace(PT_CONTINUE, newTid, 0, 0);
     ptrace(PT_CONTINUE, starterTid, 0, 0);
@@ -337,9 +374,15 @@ jboolean process_resume_all_threads(pid_t pid) {
 
     boolean result = true;
     int n = 0;
+    _watchSlotHit = -1;
     while (n < nTasks) {
         pid_t tid = tasks[n];
 
+        /* Reset the watchpoint status so that a trap is not reported again at the next stop. */
+        if (_watchSlotsInUse > 0) {
+            ptrace_watch_slot_hit(tid, _watchSlots, _watchSlotCount, true);
+        }
+
         /* Clear any left over SIGSTOP or SIGTRAP signals. */
         siginfo_t siginfo;
         ptrace(PT_GETSIGINFO, tid, NULL, &siginfo);
@@ -722,6 +765,49 @@ Java_com_sun_max_tele_debug_linux_LinuxTask_nativeCreateChildProcess(JNIEnv *env
     return -1;
 }
 
+/**
+ * Attaches ptrace to all the tasks of an existing process, such as a snapshot created by the VM
+ * with fork_snapshot(). The tasks are left stopped.
+ */
+JNIEXPORT jboolean JNICALL
+Java_com_sun_max_tele_debug_linux_LinuxTask_nativeAttach(JNIEnv *env, jclass c, jint pid) {
+    pid_t *tasks;
+    int i;
+
+    /* Configure the debugging related signals we want to intercept. */
+    sigemptyset(&_caughtSignals);
+    sigaddset(&_caughtSignals, SIGTRAP);
+    sigaddset(&_caughtSignals, SIGSTOP);
+
+    const int nTasks = scan_process_tasks(pid, &tasks);
+    if (nTasks < 0) {
+        log_println("Error scanning /proc/%d/task directory: %s", pid, strerror(errno));
+        return false;
+    }
+    for (i = 0; i < nTasks; i++) {
+        const pid_t tid = tasks[i];
+        int status;
+        int result;
+        tele_log_println("Attaching ptrace to task %d of process %d", tid, pid);
+        if (ptrace(PT_ATTACH, tid, 0, 0) != 0) {
+            log_println("Failed to attach ptrace to task %d of process %d: %s", tid, pid, strerror(errno));
+            free(tasks);
+            return false;
+        }
+        do {
+            result = waitpid(tid, &status, __WALL);
+        } while (result == -1 && errno == EINTR);
+        if (result != tid || !WIFSTOPPED(status)) {
+            log_println("Task %d of process %d did not stop after being attached", tid, pid);
+            free(tasks);
+            return false;
+        }
+        ptrace(PT_SETOPTIONS, tid, 0, PTRACE_O_TRACECLONE | PTRACE_O_TRACEEXIT);
+    }
+    free(tasks);
+    return true;
+}
+
 JNIEXPORT jboolean JNICALL
 Java_com_sun_max_tele_debug_linux_LinuxTask_nativeDetach(JNIEnv *env, jclass c, jint tgid, jint tid) {
     return ptrace(PT_DETACH, tid, 0, 0) == 0;
@@ -778,6 +864,132 @@ Java_com_sun_max_tele_debug_linux_LinuxTask_nativeKill(JNIEnv *env, jclass c, ji
     return true;
 }
 
+/**
+ * Installs the current hardware watchpoints in all tasks of a process.
+ */
+static boolean process_install_watchpoints(pid_t tgid) {
+    pid_t *tasks = NULL;
+    const int nTasks = scan_process_tasks(tgid, &tasks);
+    if (nTasks < 0) {
+        log_println("Error scanning /proc/%d/task directory: %s", tgid, strerror(errno));
+        return false;
+    }
+    boolean result = true;
+    int n;
+    for (n = 0; n < nTasks; n++) {
+        if (!task_install_watchpoints(tasks[n])) {
+            result = false;
+        }
+    }
+    free(tasks);
+    return result;
+}
+
+static void release_watch_slots(Address start, Size size) {
+    int n;
+    for (n = 0; n < _watchSlotCount; n++) {
+        if (_watchSlots[n].length != 0 && _watchRegions[n].start == start && _watchRegions[n].size == size) {
+            _watchSlots[n].length = 0;
+            _watchSlotsInUse--;
+        }
+    }
+}
+
+boolean task_watchpoint_hit(pid_t tid) {
+    if (_watchSlotsInUse == 0) {
+        return false;
+    }
+    int slot = ptrace_watch_slot_hit(tid, _watchSlots, _watchSlotCount, false);
+    if (slot < 0) {
+        return false;
+    }
+    _watchSlotHit = slot;
+    return true;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_sun_max_tele_debug_linux_LinuxTask_nativeActivateWatchpoint(JNIEnv *env, jclass c, jint tgid, jint tid, jlong address, jlong size, jboolean read, jboolean write, jboolean exec) {
+    if (_watchSlotCount < 0) {
+        _watchSlotCount = ptrace_watch_slot_count(tid);
+    }
+    const int kind = (read ? WATCH_READ : 0) | (write ? WATCH_WRITE : 0) | (exec ? WATCH_EXEC : 0);
+    if (kind == 0 || size <= 0) {
+        return false;
+    }
+
+    /* Cover the region with naturally aligned blocks of at most 8 bytes, one slot per block.
+     * An execution watchpoint only needs to cover the first byte of the region. */
+    Address start = (Address) address;
+    Address end = exec ? start + 1 : start + (Size) size;
+    Address a = start;
+    int n = 0;
+    while (a < end) {
+        int length = 8;
+        while (length > 1 && ((a & (length - 1)) != 0 || a + length > end)) {
+            length >>= 1;
+        }
+        while (n < _watchSlotCount && _watchSlots[n].length != 0) {
+            n++;
+        }
+        if (n == _watchSlotCount) {
+            log_println("Not enough hardware watchpoint slots to watch %lu bytes at %p", (Size) size, start);
+            release_watch_slots(start, (Size) size);
+            return false;
+        }
+        _watchSlots[n].address = a;
+        _watchSlots[n].length = length;
+        _watchSlots[n].kind = kind;
+        _watchRegions[n].start = start;
+        _watchRegions[n].size = (Size) size;
+        _watchSlotsInUse++;
+        a += length;
+    }
+    if (!process_install_watchpoints(tgid)) {
+        release_watch_slots(start, (Size) size);
+        process_install_watchpoints(tgid);
+        return false;
+    }
+    return true;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_sun_max_tele_debug_linux_LinuxTask_nativeDeactivateWatchpoint(JNIEnv *env, jclass c, jint tgid, jint tid, jlong address, jlong size) {
+    int inUse = _watchSlotsInUse;
+    release_watch_slots((Address) address, (Size) size);
+    if (inUse == _watchSlotsInUse) {
+        return false;
+    }
+    return process_install_watchpoints(tgid);
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_sun_max_tele_debug_linux_LinuxTask_nativeReadWatchpointAddress(JNIEnv *env, jclass c, jint tgid) {
+    if (_watchSlotHit < 0) {
+        return 0;
+    }
+    return _watchRegions[_watchSlotHit].start;
+}
+
+/* The si_code values reported for read, write and execute watchpoints by Solaris, which
+ * are the access codes expected by the Inspector. */
+#define WATCH_CODE_READ  3
+#define WATCH_CODE_WRITE 4
+#define WATCH_CODE_EXEC  5
+
+JNIEXPORT jint JNICALL
+Java_com_sun_max_tele_debug_linux_LinuxTask_nativeReadWatchpointAccessCode(JNIEnv *env, jclass c, jint tgid) {
+    if (_watchSlotHit < 0) {
+        return 0;
+    }
+    const int kind = _watchSlots[_watchSlotHit].kind;
+    if (kind & WATCH_EXEC) {
+        return WATCH_CODE_EXEC;
+    } else if (kind & WATCH_WRITE) {
+        return WATCH_CODE_WRITE;
+    }
+    return WATCH_CODE_READ;
+}
+
 /**
  * Gets an open file descriptor on /proc/<pid>/mem for reading the memory of the traced process 'tgid'.
  *
@@ -843,6 +1055,71 @@ size_t task_read(pid_t tgid, pid_t tid, const void *src, void *dst, size_t size)
     }
 }
 
+int task_read_batch(pid_t tgid, pid_t tid, int count, const Address *srcs, void **dsts, size_t size) {
+    char state;
+    if ((state = task_state(tgid, tid)) != 'T') {
+        log_println("Cannot read memory of task %d while it is in state '%c'", tid, state);
+        return 0;
+    }
+    if (count <= 0) {
+        return 0;
+    }
+    ptrace_check_tracer(POS, tgid);
+
+    struct iovec *local = (struct iovec *) malloc(2 * count * sizeof(struct iovec));
+    c_ASSERT(local != NULL);
+    struct iovec *remote = local + count;
+    int i;
+    for (i = 0; i < count; i++) {
+        local[i].iov_base = dsts[i];
+        local[i].iov_len = size;
+        remote[i].iov_base = (void *) (intptr_t) srcs[i];
+        remote[i].iov_len = size;
+    }
+
+    /* A single process_vm_readv(2) call transfers at most IOV_MAX blocks and stops at the first
+     * unreadable block, so issue as many calls as needed and fall back to /proc/<tgid>/mem
+     * for the remainder if the system call is not available or fails. */
+    int blocksRead = 0;
+    while (blocksRead < count) {
+        int n = count - blocksRead;
+        if (n > IOV_MAX) {
+            n = IOV_MAX;
+        }
+        ssize_t bytesRead = process_vm_readv(tgid, local + blocksRead, n, remote + blocksRead, n, 0);
+        if (bytesRead <= 0) {
+            break;
+        }
+        blocksRead += bytesRead / size;
+        if ((size_t) bytesRead != n * size) {
+            break;
+        }
+    }
+
+    if (blocksRead < count) {
+        char *memoryFileName;
+        asprintf(&memoryFileName, "/proc/%d/mem", tgid);
+        c_ASSERT(memoryFileName != NULL);
+        int fd = open(memoryFileName, O_RDONLY);
+        if (fd < 0) {
+            log_println("Error opening %s: %s", memoryFileName, strerror(errno));
+        } else {
+            while (blocksRead < count) {
+                ssize_t bytesRead = pread64(fd, dsts[blocksRead], size, (off64_t) srcs[blocksRead]);
+                if (bytesRead < 0 || (size_t) bytesRead != size) {
+                    log_println("Could not read %d bytes from %p: %s", size, srcs[blocksRead], strerror(errno));
+                    break;
+                }
+                blocksRead++;
+            }
+            close(fd);
+        }
+        free(memoryFileName);
+    }
+    free(local);
+    return blocksRead;
+}
+
 /**
  * Copies 'size' bytes from 'src' in the caller's address space to 'dst' in the address space of 'tgid'.
  * The value of 'size' must be >= 0 and < sizeof(Word).
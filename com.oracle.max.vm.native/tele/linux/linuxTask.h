@@ -87,6 +87,15 @@ int task_memory_read_fd(int tgid, const void *address);
  */
 size_t task_read(pid_t tgid, pid_t tid, const void *src, void *dst, size_t size);
 
+/**
+ * Copies 'count' blocks of 'size' bytes each from the addresses in 'srcs' in the address space of 'tgid'
+ * to the corresponding buffers in 'dsts' in the caller's address space. The blocks are transferred with
+ * as few system calls as possible instead of opening the memory file of 'tgid' once per block.
+ *
+ * @return the number of leading blocks that were copied completely
+ */
+int task_read_batch(pid_t tgid, pid_t tid, int count, const Address *srcs, void **dsts, size_t size);
+
 /**
  * Copies 'size' bytes from 'src' in the caller's address space to 'dst' in the address space of 'tgid'.
  * The value of 'size' must be >= 0 and < sizeof(Word).
@@ -138,6 +147,16 @@ int scan_process_tasks(pid_t pid, pid_t **tasks);
  */
 void log_task_stat(pid_t tgid, pid_t tid, const char* messageFormat, ...);
 
+/**
+ * Determines if a stopped task trapped on one of the hardware watchpoints of its process.
+ * If so, the watchpoint is recorded as the one whose address and access code are subsequently
+ * reported to the Inspector.
+ *
+ * @param tid a stopped task
+ * @return true if 'tid' is stopped at a hardware watchpoint
+ */
+boolean task_watchpoint_hit(pid_t tid);
+
 #define TASK_RETRY_PAUSE_MICROSECONDS 200 * 1000
 
 #endif
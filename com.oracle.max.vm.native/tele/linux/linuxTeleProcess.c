@@ -96,7 +96,7 @@ ThreadState_t toThreadState(char taskState, pid_t tid) {
     return threadState;
 }
 
-static void gatherThread(JNIEnv *env, pid_t tgid, pid_t tid, jobject linuxTeleProcess, jobject threadList, jlong tlaList) {
+static void gatherThread(JNIEnv *env, pid_t tgid, pid_t tid, jobject linuxTeleProcess, jobject threadList, TLAMap tlaMap) {
 
     isa_CanonicalIntegerRegistersStruct canonicalIntegerRegisters;
     isa_CanonicalStateRegistersStruct canonicalStateRegisters;
@@ -114,12 +114,13 @@ static void gatherThread(JNIEnv *env, pid_t tgid, pid_t tid, jobject linuxTelePr
 #else
         Address stackPointer = (Address) canonicalIntegerRegisters.rsp;
 #endif
-        TLA threadLocals = (TLA) alloca(tlaSize());
-        NativeThreadLocalsStruct nativeThreadLocalsStruct;
-        ProcessHandleStruct ph = {tgid, tid};
-        tla = teleProcess_findTLA(&ph, tlaList, stackPointer, threadLocals, &nativeThreadLocalsStruct);
+        tla = teleProcess_findTLAInMap(tlaMap, stackPointer);
     }
-    teleProcess_jniGatherThread(env, linuxTeleProcess, threadList, tid, toThreadState(taskState, tid), (jlong) canonicalStateRegisters.rip, tla);
+    ThreadState_t threadState = toThreadState(taskState, tid);
+    if (threadState == TS_SUSPENDED && task_watchpoint_hit(tid)) {
+        threadState = TS_WATCHPOINT;
+    }
+    teleProcess_jniGatherThread(env, linuxTeleProcess, threadList, tid, threadState, (jlong) canonicalStateRegisters.rip, tla);
 }
 
 JNIEXPORT void JNICALL
@@ -132,11 +133,23 @@ Java_com_sun_max_tele_debug_linux_LinuxNativeTeleChannelProtocol_nativeGatherThr
         return;
     }
 
+    /* The TLA list is read once for all tasks. Any stopped task can be used to read the memory of the process. */
+    ProcessHandleStruct ph = {pid, pid};
     int n = 0;
+    while (n < nTasks && task_state(pid, tasks[n]) != 'T') {
+        n++;
+    }
+    if (n < nTasks) {
+        ph.tid = tasks[n];
+    }
+    TLAMap tlaMap = teleProcess_mapTLAs(&ph, tlaList);
+
+    n = 0;
     while (n < nTasks) {
         pid_t tid = tasks[n];
-        gatherThread(env, pid, tid, linuxTeleProcess, threads, tlaList);
+        gatherThread(env, pid, tid, linuxTeleProcess, threads, tlaMap);
         n++;
     }
+    teleProcess_freeTLAMap(tlaMap);
     free(tasks);
 }
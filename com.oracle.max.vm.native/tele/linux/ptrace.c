@@ -129,3 +129,190 @@ long _ptrace(POS_PARAMS, int request, pid_t pid, void *address, void *data) {
 
     return result;
 }
+
+#if defined(__x86_64__)
+
+#include <stddef.h>
+#include <sys/user.h>
+
+#define DEBUG_REGISTER_COUNT 4
+#define DEBUG_REGISTER_OFFSET(n) ((void *) (offsetof(struct user, u_debugreg) + (n) * sizeof(((struct user *) 0)->u_debugreg[0])))
+
+/* DR7 encodings of the access kind and length of a debug register. */
+#define DR7_ENABLE(n)       (1UL << ((n) * 2))
+#define DR7_RW(n, rw)       ((unsigned long) (rw) << (16 + (n) * 4))
+#define DR7_LEN(n, len)     ((unsigned long) (len) << (18 + (n) * 4))
+#define DR7_RW_EXEC         0
+#define DR7_RW_WRITE        1
+#define DR7_RW_READ_WRITE   3
+
+static unsigned long dr7LengthBits(int length) {
+    switch (length) {
+        case 1: return 0;
+        case 2: return 1;
+        case 4: return 3;
+        case 8: return 2;
+    }
+    return 0;
+}
+
+int ptrace_watch_slot_count(pid_t tid) {
+    return DEBUG_REGISTER_COUNT;
+}
+
+int ptrace_set_watch_slots(pid_t tid, const PtraceWatchSlot *slots, int count) {
+    unsigned long dr7 = 0;
+    int n;
+
+    /* Disable all slots first so that the kernel does not validate a new address against a stale control word. */
+    if (_ptrace(POS, PT_WRITE_U, tid, DEBUG_REGISTER_OFFSET(7), 0) != 0) {
+        return false;
+    }
+    for (n = 0; n < count && n < DEBUG_REGISTER_COUNT; n++) {
+        const PtraceWatchSlot *slot = &slots[n];
+        if (slot->length == 0) {
+            continue;
+        }
+        if (_ptrace(POS, PT_WRITE_U, tid, DEBUG_REGISTER_OFFSET(n), (void *) slot->address) != 0) {
+            return false;
+        }
+        if (slot->kind & WATCH_EXEC) {
+            dr7 |= DR7_ENABLE(n) | DR7_RW(n, DR7_RW_EXEC);
+        } else {
+            /* There is no read-only encoding: a read watchpoint traps on writes as well. */
+            unsigned long rw = (slot->kind & WATCH_READ) ? DR7_RW_READ_WRITE : DR7_RW_WRITE;
+            dr7 |= DR7_ENABLE(n) | DR7_RW(n, rw) | DR7_LEN(n, dr7LengthBits(slot->length));
+        }
+    }
+    return _ptrace(POS, PT_WRITE_U, tid, DEBUG_REGISTER_OFFSET(7), (void *) dr7) == 0;
+}
+
+int ptrace_watch_slot_hit(pid_t tid, const PtraceWatchSlot *slots, int count, int clear) {
+    errno = 0;
+    unsigned long dr6 = _ptrace(POS, PT_READ_U, tid, DEBUG_REGISTER_OFFSET(6), 0);
+    if (errno != 0) {
+        return -1;
+    }
+    int n;
+    for (n = 0; n < count && n < DEBUG_REGISTER_COUNT; n++) {
+        if (slots[n].length != 0 && (dr6 & (1UL << n)) != 0) {
+            if (clear) {
+                _ptrace(POS, PT_WRITE_U, tid, DEBUG_REGISTER_OFFSET(6), 0);
+            }
+            return n;
+        }
+    }
+    return -1;
+}
+
+#elif defined(__aarch64__)
+
+#include <signal.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+/* Mirrors 'struct user_hwdebug_state' from <asm/ptrace.h>. */
+typedef struct {
+    uint32_t dbg_info;
+    uint32_t pad;
+    struct {
+        uint64_t addr;
+        uint32_t ctrl;
+        uint32_t pad;
+    } dbg_regs[PTRACE_MAX_WATCH_SLOTS];
+} HwDebugState;
+
+/* Fields of a watchpoint control register (DBGWCR). */
+#define WCR_ENABLE          1
+#define WCR_PRIVILEGE_EL0   (2 << 1)
+#define WCR_LOAD            (1 << 3)
+#define WCR_STORE           (2 << 3)
+#define WCR_BYTE_SELECT(b)  ((b) << 5)
+
+#ifndef TRAP_HWBKPT
+#define TRAP_HWBKPT 4
+#endif
+
+int ptrace_watch_slot_count(pid_t tid) {
+    HwDebugState state;
+    struct iovec iov;
+    iov.iov_base = &state;
+    iov.iov_len = sizeof(state);
+    if (_ptrace(POS, PT_GETREGSET, tid, (void *) NT_ARM_HW_WATCH, &iov) != 0) {
+        return 0;
+    }
+    int slots = state.dbg_info & 0xff;
+    return slots > PTRACE_MAX_WATCH_SLOTS ? PTRACE_MAX_WATCH_SLOTS : slots;
+}
+
+int ptrace_set_watch_slots(pid_t tid, const PtraceWatchSlot *slots, int count) {
+    HwDebugState state;
+    int n;
+    memset(&state, 0, sizeof(state));
+    for (n = 0; n < count && n < PTRACE_MAX_WATCH_SLOTS; n++) {
+        const PtraceWatchSlot *slot = &slots[n];
+        if (slot->length == 0) {
+            continue;
+        }
+        if (slot->kind & WATCH_EXEC) {
+            /* Execution is trapped by the breakpoint registers, not the watchpoint registers. */
+            return false;
+        }
+        Address base = slot->address & ~((Address) 7);
+        uint32_t byteSelect = ((1 << slot->length) - 1) << (slot->address - base);
+        uint32_t ctrl = WCR_ENABLE | WCR_PRIVILEGE_EL0 | WCR_BYTE_SELECT(byteSelect);
+        if (slot->kind & WATCH_READ) {
+            ctrl |= WCR_LOAD;
+        }
+        if (slot->kind & WATCH_WRITE) {
+            ctrl |= WCR_STORE;
+        }
+        state.dbg_regs[n].addr = base;
+        state.dbg_regs[n].ctrl = ctrl;
+    }
+    struct iovec iov;
+    iov.iov_base = &state;
+    iov.iov_len = offsetof(HwDebugState, dbg_regs) + n * sizeof(state.dbg_regs[0]);
+    return _ptrace(POS, PT_SETREGSET, tid, (void *) NT_ARM_HW_WATCH, &iov) == 0;
+}
+
+int ptrace_watch_slot_hit(pid_t tid, const PtraceWatchSlot *slots, int count, int clear) {
+    siginfo_t siginfo;
+    if (_ptrace(POS, PT_GETSIGINFO, tid, NULL, &siginfo) != 0) {
+        return -1;
+    }
+    if (siginfo.si_signo != SIGTRAP || siginfo.si_code != TRAP_HWBKPT) {
+        return -1;
+    }
+    /* The reported address is the one accessed, which may lie anywhere in the watched doubleword. */
+    Address address = (Address) siginfo.si_addr;
+    int n;
+    for (n = 0; n < count; n++) {
+        Address base = slots[n].address & ~((Address) 7);
+        if (slots[n].length != 0 && address >= base && address < base + 8) {
+            if (clear) {
+                siginfo.si_code = 0;
+                _ptrace(POS, PT_SETSIGINFO, tid, NULL, &siginfo);
+            }
+            return n;
+        }
+    }
+    return -1;
+}
+
+#else
+
+int ptrace_watch_slot_count(pid_t tid) {
+    return 0;
+}
+
+int ptrace_set_watch_slots(pid_t tid, const PtraceWatchSlot *slots, int count) {
+    return false;
+}
+
+int ptrace_watch_slot_hit(pid_t tid, const PtraceWatchSlot *slots, int count, int clear) {
+    return -1;
+}
+
+#endif
@@ -56,6 +56,11 @@
 #define PT_GETEVENTMSG 0x4201
 #define PT_GETSIGINFO  0x4202
 #define PT_SETSIGINFO  0x4203
+#define PT_GETREGSET   0x4204
+#define PT_SETREGSET   0x4205
+
+/* The register set holding the hardware watchpoint registers on AArch64 (see <linux/elf.h>). */
+#define NT_ARM_HW_WATCH 0x403
 
 #define PTRACE_O_TRACESYSGOOD   0x00000001
 #define PTRACE_O_TRACEFORK      0x00000002
@@ -100,6 +105,51 @@ extern long int ptrace (int request, pid_t pid, void *address, void *data);
  */
 extern const char* ptraceEventName(int event);
 
+/* The kinds of access that can be trapped by a hardware watchpoint, combined as a bit mask. */
+#define WATCH_READ  1
+#define WATCH_WRITE 2
+#define WATCH_EXEC  4
+
+/* An upper bound on the number of hardware watchpoint slots of any supported processor. */
+#define PTRACE_MAX_WATCH_SLOTS 16
+
+/**
+ * A hardware watchpoint covering a naturally aligned block of 1, 2, 4 or 8 bytes.
+ * A slot whose 'length' is 0 is unused.
+ */
+typedef struct {
+    unsigned long address;
+    int length;
+    int kind;
+} PtraceWatchSlot;
+
+/**
+ * Gets the number of hardware watchpoint slots available for a stopped task.
+ *
+ * @return the number of slots, which is 0 if hardware watchpoints are not supported on this platform
+ */
+extern int ptrace_watch_slot_count(pid_t tid);
+
+/**
+ * Programs the hardware watchpoint registers of a stopped task. The debug registers are per task,
+ * so this has to be done for every task in a process (including tasks created later).
+ *
+ * @param slots the watchpoints to install; slot i is programmed into hardware watchpoint register i
+ * @param count the number of entries in 'slots', which must not exceed ptrace_watch_slot_count(tid)
+ * @return non-zero if the registers were updated, 0 otherwise
+ */
+extern int ptrace_set_watch_slots(pid_t tid, const PtraceWatchSlot *slots, int count);
+
+/**
+ * Determines which hardware watchpoint slot caused a stopped task to trap.
+ *
+ * @param slots the watchpoints currently installed
+ * @param count the number of entries in 'slots'
+ * @param clear specifies if the trap status should be reset so that the same hit is not reported again
+ * @return the index of the slot that was hit or -1 if the task was not stopped by a hardware watchpoint
+ */
+extern int ptrace_watch_slot_hit(pid_t tid, const PtraceWatchSlot *slots, int count, int clear);
+
 /**
  * Checks that the current task/thread is the one designated as the parent of the ptraced process 'pid'.
  * The ptraced process can only be accessed from this parent.
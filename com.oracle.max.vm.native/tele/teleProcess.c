@@ -122,6 +122,114 @@ TLA teleProcess_findTLA(ProcessHandle ph, Address tlaList, Address stackPointer,
     return 0;
 }
 
+#ifndef readProcessMemoryBatch
+static int readProcessMemoryBatch(ProcessHandle ph, int count, const Address *srcs, void **dsts, size_t size) {
+    int i;
+    for (i = 0; i < count; i++) {
+        if ((size_t) readProcessMemory(ph, srcs[i], dsts[i], size) != size) {
+            break;
+        }
+    }
+    return i;
+}
+#endif
+
+static int compareTLAMapEntries(const void *a, const void *b) {
+    Address x = ((TLAMapEntry) a)->stackBase;
+    Address y = ((TLAMapEntry) b)->stackBase;
+    return x < y ? -1 : x > y ? 1 : 0;
+}
+
+TLAMap teleProcess_mapTLAs(ProcessHandle ph, Address tlaList) {
+    TLAMap map = (TLAMap) calloc(1, sizeof(TLAMapStruct));
+    c_ASSERT(map != NULL);
+
+    /* Only the link word is needed to walk the list, so collect the list addresses first. */
+    int capacity = 64;
+    Address *tlas = (Address *) malloc(capacity * sizeof(Address));
+    c_ASSERT(tlas != NULL);
+    int count = 0;
+    Address tla = tlaList;
+    while (tla != 0) {
+        if (count == capacity) {
+            capacity *= 2;
+            tlas = (Address *) realloc(tlas, capacity * sizeof(Address));
+            c_ASSERT(tlas != NULL);
+        }
+        tlas[count++] = tla;
+        Address next;
+        if (readProcessMemory(ph, tla_addressOf(tla, FORWARD_LINK), &next, sizeof(Address)) != sizeof(Address)) {
+            break;
+        }
+        tla = next;
+    }
+
+    const int size = tlaSize();
+    map->entries = (TLAMapEntry) calloc(count == 0 ? 1 : count, sizeof(TLAMapEntryStruct));
+    map->tlaCopies = calloc(count == 0 ? 1 : count, size);
+    void **dsts = (void **) malloc((count == 0 ? 1 : count) * sizeof(void *));
+    Address *ntls = (Address *) malloc((count == 0 ? 1 : count) * sizeof(Address));
+    c_ASSERT(map->entries != NULL && map->tlaCopies != NULL && dsts != NULL && ntls != NULL);
+
+    int i;
+    for (i = 0; i < count; i++) {
+        dsts[i] = (char *) map->tlaCopies + (i * size);
+    }
+    count = readProcessMemoryBatch(ph, count, tlas, dsts, size);
+
+    for (i = 0; i < count; i++) {
+        ntls[i] = tla_load(Address, (TLA) dsts[i], NATIVE_THREAD_LOCALS);
+        dsts[i] = &map->entries[i].ntl;
+    }
+    count = readProcessMemoryBatch(ph, count, ntls, dsts, sizeof(NativeThreadLocalsStruct));
+
+    for (i = 0; i < count; i++) {
+        TLAMapEntry entry = &map->entries[i];
+        entry->stackBase = entry->ntl.stackBase;
+        entry->stackEnd = entry->ntl.stackBase + entry->ntl.stackSize;
+        entry->tla = (TLA) ((char *) map->tlaCopies + (i * size));
+    }
+    qsort(map->entries, count, sizeof(TLAMapEntryStruct), compareTLAMapEntries);
+    /* The NATIVE_THREAD_LOCALS slots can only be redirected to the local copies once the entries have stopped moving. */
+    for (i = 0; i < count; i++) {
+        TLAMapEntry entry = &map->entries[i];
+        tla_store(entry->tla, NATIVE_THREAD_LOCALS, &entry->ntl);
+#if log_TELE
+        log_print("teleProcess_mapTLAs: ");
+        tla_println(entry->tla);
+#endif
+    }
+    map->count = count;
+
+    free(ntls);
+    free(dsts);
+    free(tlas);
+    return map;
+}
+
+TLA teleProcess_findTLAInMap(TLAMap map, Address stackPointer) {
+    int low = 0;
+    int high = map->count - 1;
+    while (low <= high) {
+        int mid = (low + high) >> 1;
+        TLAMapEntry entry = &map->entries[mid];
+        if (stackPointer < entry->stackBase) {
+            high = mid - 1;
+        } else if (stackPointer >= entry->stackEnd) {
+            low = mid + 1;
+        } else {
+            return entry->tla;
+        }
+    }
+    return 0;
+}
+
+void teleProcess_freeTLAMap(TLAMap map) {
+    free(map->tlaCopies);
+    free(map->entries);
+    free(map);
+}
+
 int teleProcess_read(ProcessHandle ph, JNIEnv *env, jclass c, jlong src, jobject dst, jboolean isDirectByteBuffer, jint offset, jint length) {
     Word bufferWord;
     void* dstBuffer;
@@ -51,6 +51,8 @@ typedef struct {
 #include <stdint.h>
 #define readProcessMemory(ph, src, dst, size) task_read(ph->tgid, ph->tid, (const void *) (intptr_t) src, (void *) (intptr_t) dst, (size_t) size)
 #define writeProcessMemory(ph, dst, src, size) task_write(ph->tgid, ph->tid, (void *) (intptr_t) dst, (const void *) (intptr_t) src, (size_t) size)
+int task_read_batch(pid_t tgid, pid_t tid, int count, const Address *srcs, void **dsts, size_t size);
+#define readProcessMemoryBatch(ph, count, srcs, dsts, size) task_read_batch(ph->tgid, ph->tid, count, srcs, dsts, (size_t) size)
 #elif os_DARWIN
 #include <mach/mach.h>
 int task_read(task_t task, vm_address_t src, void *dst, size_t size);
@@ -97,6 +99,44 @@ typedef struct maxve_memory_handler *ProcessHandle;
  */
 extern TLA teleProcess_findTLA(ProcessHandle ph, Address tlaList, Address stackPointer, TLA tlaCopy, NativeThreadLocals ntlCopy);
 
+/**
+ * The thread locals of one VM thread, copied from the VM's address space by teleProcess_mapTLAs().
+ * The NATIVE_THREAD_LOCALS slot of 'tla' points to 'ntl'.
+ */
+typedef struct TLAMapEntry {
+    Address stackBase;
+    Address stackEnd;
+    TLA tla;
+    NativeThreadLocalsStruct ntl;
+} TLAMapEntryStruct, *TLAMapEntry;
+
+typedef struct TLAMap {
+    int count;
+    TLAMapEntry entries;
+    void *tlaCopies;
+} TLAMapStruct, *TLAMap;
+
+/**
+ * Copies every entry of the thread locals list in the VM's address space into a map sorted by stack
+ * range, so that the threads of a stopped VM can be matched to their TLAs with a single pass over the list.
+ * The thread locals and native thread locals blocks are each fetched with one batched read where the
+ * platform supports it.
+ *
+ * @param ph a platform specific process handle
+ * @param tlaList the head of the thread locals list in the VM's address space
+ * @return the map, which must be released with teleProcess_freeTLAMap()
+ */
+extern TLAMap teleProcess_mapTLAs(ProcessHandle ph, Address tlaList);
+
+/**
+ * Searches a map built by teleProcess_mapTLAs() for the entry whose stack contains 'stackPointer'.
+ *
+ * @return the copy of the TLA for the found entry, NULL otherwise
+ */
+extern TLA teleProcess_findTLAInMap(TLAMap map, Address stackPointer);
+
+extern void teleProcess_freeTLAMap(TLAMap map);
+
 /**
  * Makes the upcall to TeleProcess.jniGatherThread
  *
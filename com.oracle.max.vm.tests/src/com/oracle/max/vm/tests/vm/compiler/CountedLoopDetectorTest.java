@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package com.oracle.max.vm.tests.vm.compiler;
+
+import static com.sun.cri.bytecode.Bytecodes.*;
+
+import junit.framework.*;
+
+import com.oracle.max.vm.tests.vm.*;
+import com.sun.c1x.graph.*;
+import com.sun.cri.bytecode.*;
+import com.sun.max.lang.*;
+import com.sun.max.vm.actor.holder.*;
+import com.sun.max.vm.actor.member.*;
+import com.sun.max.vm.classfile.constant.*;
+import com.sun.max.vm.hosted.*;
+
+/**
+ * Tests {@link CountedLoopDetector} on loops compiled by javac, which tests the loop condition at the top of
+ * the loop and closes it with a backward {@code goto}.
+ */
+@org.junit.runner.RunWith(org.junit.runners.AllTests.class)
+public class CountedLoopDetectorTest extends VmTestCase {
+
+    public CountedLoopDetectorTest(String name) {
+        super(name);
+    }
+
+    public static Test suite() {
+        final TestSuite suite = new TestSuite(CountedLoopDetectorTest.class.getName());
+        suite.addTestSuite(CountedLoopDetectorTest.class);
+        return new VmTestSetup(suite);
+    }
+
+    public static void main(String[] args) {
+        junit.textui.TestRunner.run(CountedLoopDetectorTest.suite());
+    }
+
+    static int shortLoop() {
+        int sum = 0;
+        for (int i = 0; i < 10; i++) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    static int shortCountdownLoop() {
+        int sum = 0;
+        for (int i = 10; i > 0; i -= 2) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    static int shortLoopWithBreak(int[] a) {
+        int sum = 0;
+        for (int i = 0; i < 8; i++) {
+            if (a[i] < 0) {
+                break;
+            }
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static int longLoop() {
+        int sum = 0;
+        for (int i = 0; i < 30000; i++) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    static int variableBoundLoop(int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += i;
+        }
+        return sum;
+    }
+
+    static int inductionVariableWrittenInBody() {
+        int sum = 0;
+        for (int i = 0; i < 10; i++) {
+            if (sum > 3) {
+                i++;
+            }
+            sum += i;
+        }
+        return sum;
+    }
+
+    private static ClassMethodActor methodActor(String name) {
+        final Class testClass = Classes.load(HostedVMClassLoader.HOSTED_VM_CLASS_LOADER, CountedLoopDetectorTest.class.getName());
+        final ClassMethodActor methodActor = ClassActor.fromJava(testClass).findLocalStaticMethodActor(SymbolTable.makeSymbol(name));
+        assertNotNull(name, methodActor);
+        return methodActor;
+    }
+
+    /**
+     * Gets the bytecode index of the backward {@code goto} closing the single loop of a method.
+     */
+    private static int backEdge(ClassMethodActor methodActor) {
+        final BytecodeStream s = new BytecodeStream(methodActor.code());
+        while (s.currentBC() != END) {
+            if (s.currentBC() == GOTO && s.readBranchDest() < s.currentBCI()) {
+                return s.currentBCI();
+            }
+            s.next();
+        }
+        fail("no backward goto in " + methodActor);
+        return -1;
+    }
+
+    private static boolean isShortCountedLoop(String name) {
+        final ClassMethodActor methodActor = methodActor(name);
+        return CountedLoopDetector.isShortCountedLoop(methodActor, backEdge(methodActor));
+    }
+
+    public void test_shortLoops() {
+        assertTrue(isShortCountedLoop("shortLoop"));
+        assertTrue(isShortCountedLoop("shortCountdownLoop"));
+        assertTrue(isShortCountedLoop("shortLoopWithBreak"));
+    }
+
+    public void test_otherLoops() {
+        assertFalse(isShortCountedLoop("longLoop"));
+        assertFalse(isShortCountedLoop("variableBoundLoop"));
+        assertFalse(isShortCountedLoop("inductionVariableWrittenInBody"));
+    }
+}
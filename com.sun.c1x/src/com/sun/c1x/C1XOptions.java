@@ -119,6 +119,10 @@ public final class C1XOptions {
     public static boolean OptDeadCodeElimination2;
     public static boolean OptControlFlow;
     public static boolean OptMoveElimination;
+    public static boolean OptElideCountedLoopPolls;
+
+    // safepoint poll settings: bytecodes a counted loop may execute without polling
+    public static int     CountedLoopPollElisionLimit   = 5000;
 
     // optimistic optimization settings
     public static boolean UseAssumptions                = true;
@@ -211,6 +215,7 @@ public final class C1XOptions {
         OptControlFlow                  = l;
         OptMoveElimination              = l;
         OptNullCheckElimination         = l;
+        OptElideCountedLoopPolls        = l;
 
         // Level 2 optimizations
         OptInline                       = ll;
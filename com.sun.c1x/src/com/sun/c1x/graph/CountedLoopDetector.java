@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package com.sun.c1x.graph;
+
+import static com.sun.cri.bytecode.Bytecodes.*;
+
+import com.sun.c1x.*;
+import com.sun.cri.bytecode.*;
+import com.sun.cri.ri.*;
+
+/**
+ * Recognizes innermost counted loops whose total amount of work is small enough for the safepoint
+ * poll on their back-edge to be omitted without hurting time-to-safepoint.
+ * <p>
+ * The analysis works on bytecode and accepts the two shapes compilers emit for
+ * {@code for (int i = c0; i < c1; i += c2)} and the equivalent {@code while} loops. javac tests the
+ * condition at the top of the loop, with an {@code if<cond>} instead of the comparison if {@code c1} is 0,
+ * and closes it with an unconditional {@code goto}:
+ *
+ * <pre>
+ *     push c0; istore i
+ * header:
+ *     iload i; push c1; if_icmpge exit
+ *     ...                          // the body
+ *     iinc i, c2
+ *     goto header
+ * exit:
+ * </pre>
+ *
+ * ecj tests the condition at the bottom of the loop and closes it with the conditional branch:
+ *
+ * <pre>
+ *     push c0; istore i; goto cond
+ * body:
+ *     ...                          // the body
+ *     iinc i, c2
+ * cond:
+ *     iload i; push c1; if_icmplt body
+ * </pre>
+ *
+ * The body must not write {@code i}, branch backwards, contain switches or subroutines, or branch past
+ * the increment other than out of the loop. The loop must be entered only through its entry sequence
+ * and must not contain an exception handler entry. The trip count is then bounded by the constants, and
+ * the loop qualifies if the trip count multiplied by the bytecode size of the loop does not exceed
+ * {@link C1XOptions#CountedLoopPollElisionLimit}.
+ */
+public final class CountedLoopDetector {
+
+    private CountedLoopDetector() {
+    }
+
+    /**
+     * Determines if the safepoint poll on a back-edge can be elided.
+     *
+     * @param method the method containing the back-edge
+     * @param backEdgeBCI the bytecode index of the backward {@code goto} or conditional branch
+     * @return {@code true} if the branch closes a counted loop whose work is bounded by
+     *         {@link C1XOptions#CountedLoopPollElisionLimit}
+     */
+    public static boolean isShortCountedLoop(RiResolvedMethod method, int backEdgeBCI) {
+        BytecodeStream s = new BytecodeStream(method.code());
+        s.setBCI(backEdgeBCI);
+        if (s.currentBC() == GOTO) {
+            return isShortTopTestedLoop(method, s, backEdgeBCI);
+        }
+        return isShortBottomTestedLoop(method, s, backEdgeBCI);
+    }
+
+    private static boolean isShortTopTestedLoop(RiResolvedMethod method, BytecodeStream s, int backEdgeBCI) {
+        // back-edge: goto header
+        int headerBCI = s.readBranchDest();
+        int exitBCI = s.nextBCI();
+        if (headerBCI >= backEdgeBCI) {
+            return false;
+        }
+
+        // header: iload i; push bound; if_icmp<cond> exit, or iload i; if<cond> exit for a bound of 0
+        s.setBCI(headerBCI);
+        int local = loadedIntLocal(s);
+        if (local < 0) {
+            return false;
+        }
+        s.next();
+        long bound = 0;
+        if (!isZeroTest(s.currentBC())) {
+            Integer boundConstant = intConstant(s);
+            if (boundConstant == null) {
+                return false;
+            }
+            bound = boundConstant;
+            s.next();
+        }
+        int cond;
+        switch (s.currentBC()) {
+            case IF_ICMPGE: case IFGE: cond = IF_ICMPLT; break;
+            case IF_ICMPGT: case IFGT: cond = IF_ICMPLE; break;
+            case IF_ICMPLE: case IFLE: cond = IF_ICMPGT; break;
+            case IF_ICMPLT: case IFLT: cond = IF_ICMPGE; break;
+            default:        return false;
+        }
+        if (s.readBranchDest() != exitBCI) {
+            return false;
+        }
+        int bodyBCI = s.nextBCI();
+
+        // the increment must immediately precede the back-edge so it is executed on every iteration
+        int incrementBCI = previousBCI(s, backEdgeBCI);
+        if (incrementBCI < bodyBCI) {
+            return false;
+        }
+        s.setBCI(incrementBCI);
+        if (s.currentBC() != IINC || s.readLocalIndex() != local) {
+            return false;
+        }
+        final int step = s.readIncrement();
+
+        // entry: push start; istore i; fall through into the header
+        Integer startConstant = initialValue(s, previousBCI(s, headerBCI), local);
+        if (startConstant == null) {
+            return false;
+        }
+        final long start = startConstant;
+
+        if (step == 0 || !isSimpleBody(s, local, bodyBCI, incrementBCI, backEdgeBCI) || !singleEntry(method, s, -1, headerBCI, backEdgeBCI)) {
+            return false;
+        }
+        return isShort(tripCount(cond, start, bound, step), backEdgeBCI + lengthOf(GOTO) - headerBCI);
+    }
+
+    private static boolean isShortBottomTestedLoop(RiResolvedMethod method, BytecodeStream s, int backEdgeBCI) {
+        // back-edge: iload i; push bound; if_icmp<cond> header
+        int cond = s.currentBC();
+        if (cond != IF_ICMPLT && cond != IF_ICMPLE && cond != IF_ICMPGT && cond != IF_ICMPGE) {
+            return false;
+        }
+        int headerBCI = s.readBranchDest();
+        if (headerBCI >= backEdgeBCI) {
+            return false;
+        }
+        int gotoBCI = previousBCI(s, headerBCI);
+        if (gotoBCI < 0) {
+            return false;
+        }
+        int boundBCI = previousBCI(s, backEdgeBCI);
+        int loadBCI = boundBCI < 0 ? -1 : previousBCI(s, boundBCI);
+        if (loadBCI < 0) {
+            return false;
+        }
+        s.setBCI(boundBCI);
+        Integer boundConstant = intConstant(s);
+        s.setBCI(loadBCI);
+        int local = loadedIntLocal(s);
+        if (boundConstant == null || local < 0) {
+            return false;
+        }
+        final long bound = boundConstant;
+
+        // entry: push start; istore i; goto cond
+        s.setBCI(gotoBCI);
+        if (s.currentBC() != GOTO) {
+            return false;
+        }
+        if (s.readBranchDest() != loadBCI) {
+            return false;
+        }
+        // the increment must immediately precede the condition so it is executed on every iteration
+        int incrementBCI = previousBCI(s, loadBCI);
+        if (incrementBCI <= headerBCI) {
+            return false;
+        }
+        s.setBCI(incrementBCI);
+        if (s.currentBC() != IINC || s.readLocalIndex() != local) {
+            return false;
+        }
+        final int step = s.readIncrement();
+        Integer startConstant = initialValue(s, previousBCI(s, gotoBCI), local);
+        if (startConstant == null) {
+            return false;
+        }
+        final long start = startConstant;
+
+        if (step == 0 || !isSimpleBody(s, local, headerBCI, incrementBCI, backEdgeBCI) || !singleEntry(method, s, gotoBCI, headerBCI, backEdgeBCI)) {
+            return false;
+        }
+        return isShort(tripCount(cond, start, bound, step), backEdgeBCI + lengthOf(cond) - headerBCI);
+    }
+
+    /**
+     * Gets the constant stored to the induction variable by the {@code push c0; istore i} sequence ending at {@code storeBCI}.
+     *
+     * @return the constant or {@code null} if the instructions do not have that shape
+     */
+    private static Integer initialValue(BytecodeStream s, int storeBCI, int local) {
+        int startBCI = storeBCI < 0 ? -1 : previousBCI(s, storeBCI);
+        if (startBCI < 0) {
+            return null;
+        }
+        s.setBCI(storeBCI);
+        if (s.currentBC() != ISTORE && (s.currentBC() < ISTORE_0 || s.currentBC() > ISTORE_3) || !writesLocal(s, local)) {
+            return null;
+        }
+        s.setBCI(startBCI);
+        return intConstant(s);
+    }
+
+    /**
+     * Checks that the body {@code [bodyBCI, incrementBCI)} does not write the induction variable and has no way to
+     * loop or to skip the increment.
+     */
+    private static boolean isSimpleBody(BytecodeStream s, int local, int bodyBCI, int incrementBCI, int backEdgeBCI) {
+        s.setBCI(bodyBCI);
+        while (s.currentBCI() < incrementBCI) {
+            int opcode = s.currentBC();
+            switch (opcode) {
+                case IINC:
+                    if (s.readLocalIndex() == local) {
+                        return false;
+                    }
+                    break;
+                case JSR:
+                case JSR_W:
+                case RET:
+                case GOTO_W:
+                case TABLESWITCH:
+                case LOOKUPSWITCH:
+                    return false;
+                default:
+                    if (isStore(opcode) && writesLocal(s, local)) {
+                        return false;
+                    }
+                    if (isBranch(opcode)) {
+                        int dest = s.readBranchDest();
+                        if (dest <= s.currentBCI() || (dest > incrementBCI && dest <= backEdgeBCI)) {
+                            return false;
+                        }
+                    }
+            }
+            s.next();
+        }
+        return true;
+    }
+
+    /**
+     * Computes the number of iterations of a loop that continues while {@code i cond bound} holds.
+     *
+     * @return the trip count or -1 if the step does not move the induction variable towards the bound
+     */
+    private static long tripCount(int cond, long start, long bound, int step) {
+        // The bound and the step are at most 16-bit constants so the induction variable cannot overflow
+        switch (cond) {
+            case IF_ICMPLT: return step > 0 ? divideRoundUp(bound - start, step) : -1;
+            case IF_ICMPLE: return step > 0 ? divideRoundUp(bound - start + 1, step) : -1;
+            case IF_ICMPGT: return step < 0 ? divideRoundUp(start - bound, -step) : -1;
+            default:        return step < 0 ? divideRoundUp(start - bound + 1, -step) : -1;
+        }
+    }
+
+    private static boolean isZeroTest(int opcode) {
+        return opcode == IFLT || opcode == IFLE || opcode == IFGT || opcode == IFGE;
+    }
+
+    private static boolean isShort(long trips, int loopSize) {
+        return trips >= 0 && trips * loopSize <= C1XOptions.CountedLoopPollElisionLimit;
+    }
+
+    private static long divideRoundUp(long n, long d) {
+        return n <= 0 ? 0 : (n + d - 1) / d;
+    }
+
+    /**
+     * Checks that the only control transfers into the loop {@code [headerBCI, backEdgeBCI]} from outside of it
+     * are the entry {@code goto} at {@code gotoBCI}, if any, or falling through into the header, and that no
+     * exception handler starts inside the loop.
+     */
+    private static boolean singleEntry(RiResolvedMethod method, BytecodeStream s, int gotoBCI, int headerBCI, int backEdgeBCI) {
+        RiExceptionHandler[] handlers = method.exceptionHandlers();
+        if (handlers != null) {
+            for (RiExceptionHandler handler : handlers) {
+                if (handler.handlerBCI() >= headerBCI && handler.handlerBCI() <= backEdgeBCI) {
+                    return false;
+                }
+            }
+        }
+        s.setBCI(0);
+        while (s.currentBC() != END) {
+            int bci = s.currentBCI();
+            if (bci != gotoBCI && (bci < headerBCI || bci > backEdgeBCI)) {
+                int opcode = s.currentBC();
+                if (opcode == TABLESWITCH || opcode == LOOKUPSWITCH) {
+                    BytecodeSwitch sw = opcode == TABLESWITCH ? new BytecodeTableSwitch(s, bci) : new BytecodeLookupSwitch(s, bci);
+                    if (inLoop(sw.defaultTarget(), headerBCI, backEdgeBCI)) {
+                        return false;
+                    }
+                    for (int i = 0; i < sw.numberOfCases(); i++) {
+                        if (inLoop(sw.targetAt(i), headerBCI, backEdgeBCI)) {
+                            return false;
+                        }
+                    }
+                } else if (opcode == GOTO_W || opcode == JSR_W) {
+                    if (inLoop(s.readFarBranchDest(), headerBCI, backEdgeBCI)) {
+                        return false;
+                    }
+                } else if (isBranch(opcode) && inLoop(s.readBranchDest(), headerBCI, backEdgeBCI)) {
+                    return false;
+                }
+            }
+            s.next();
+        }
+        return true;
+    }
+
+    private static boolean inLoop(int bci, int headerBCI, int backEdgeBCI) {
+        return bci >= headerBCI && bci <= backEdgeBCI;
+    }
+
+    /**
+     * Gets the index of the instruction immediately preceding the one at {@code bci}.
+     *
+     * @return the preceding bytecode index or -1 if {@code bci} is 0 or not an instruction boundary
+     */
+    private static int previousBCI(BytecodeStream s, int bci) {
+        int prev = -1;
+        s.setBCI(0);
+        while (s.currentBCI() < bci) {
+            prev = s.currentBCI();
+            s.next();
+        }
+        return s.currentBCI() == bci ? prev : -1;
+    }
+
+    private static Integer intConstant(BytecodeStream s) {
+        int opcode = s.currentBC();
+        if (opcode >= ICONST_M1 && opcode <= ICONST_5) {
+            return opcode - ICONST_0;
+        } else if (opcode == BIPUSH) {
+            return (int) s.readByte();
+        } else if (opcode == SIPUSH) {
+            return (int) s.readShort();
+        }
+        return null;
+    }
+
+    private static int loadedIntLocal(BytecodeStream s) {
+        int opcode = s.currentBC();
+        if (opcode == ILOAD) {
+            return s.readLocalIndex();
+        } else if (opcode >= ILOAD_0 && opcode <= ILOAD_3) {
+            return opcode - ILOAD_0;
+        }
+        return -1;
+    }
+
+    /**
+     * Determines if the current store instruction writes a given local variable, taking
+     * into account that {@code long} and {@code double} values occupy two locals.
+     */
+    private static boolean writesLocal(BytecodeStream s, int local) {
+        int opcode = s.currentBC();
+        int index;
+        boolean twoSlots = false;
+        switch (opcode) {
+            case ISTORE: case FSTORE: case ASTORE:
+                index = s.readLocalIndex();
+                break;
+            case LSTORE: case DSTORE:
+                index = s.readLocalIndex();
+                twoSlots = true;
+                break;
+            case ISTORE_0: case ISTORE_1: case ISTORE_2: case ISTORE_3:
+                index = opcode - ISTORE_0;
+                break;
+            case FSTORE_0: case FSTORE_1: case FSTORE_2: case FSTORE_3:
+                index = opcode - FSTORE_0;
+                break;
+            case ASTORE_0: case ASTORE_1: case ASTORE_2: case ASTORE_3:
+                index = opcode - ASTORE_0;
+                break;
+            case LSTORE_0: case LSTORE_1: case LSTORE_2: case LSTORE_3:
+                index = opcode - LSTORE_0;
+                twoSlots = true;
+                break;
+            case DSTORE_0: case DSTORE_1: case DSTORE_2: case DSTORE_3:
+                index = opcode - DSTORE_0;
+                twoSlots = true;
+                break;
+            default:
+                return false;
+        }
+        return index == local || (twoSlots && index + 1 == local);
+    }
+}
@@ -690,6 +690,9 @@ public final class GraphBuilder {
 
     void genGoto(int fromBCI, int toBCI) {
         boolean isSafepointPoll = !scopeData.noSafepointPolls() && toBCI <= fromBCI;
+        if (isSafepointPoll && C1XOptions.OptElideCountedLoopPolls && CountedLoopDetector.isShortCountedLoop(method(), fromBCI)) {
+            isSafepointPoll = false;
+        }
         FrameState stateBefore = curState.immutableCopy(bci());
         append(new Goto(blockAt(toBCI), stateBefore, isSafepointPoll));
     }
@@ -698,7 +701,10 @@ public final class GraphBuilder {
         BlockBegin tsucc = blockAt(stream().readBranchDest());
         BlockBegin fsucc = blockAt(stream().nextBCI());
         int bci = stream().currentBCI();
-        boolean isSafepointPoll = !scopeData.noSafepointPolls() && tsucc.bci() <= bci || fsucc.bci() <= bci;
+        boolean isSafepointPoll = !scopeData.noSafepointPolls() && (tsucc.bci() <= bci || fsucc.bci() <= bci);
+        if (isSafepointPoll && C1XOptions.OptElideCountedLoopPolls && tsucc.bci() <= bci && CountedLoopDetector.isShortCountedLoop(method(), bci)) {
+            isSafepointPoll = false;
+        }
         append(new If(x, cond, false, y, tsucc, fsucc, isSafepointPoll ? stateBefore : null, isSafepointPoll));
     }
 
@@ -1115,6 +1121,15 @@ public final class GraphBuilder {
         }
     }
 
+    /**
+     * Generates a statically bound call to {@code target} on behalf of an intrinsic, inlining it if possible.
+     * The result of the call is pushed onto the operand stack (inlining may continue parsing in a new block),
+     * so an intrinsic using this must return {@code null} from {@link C1XIntrinsicImpl#createHIR}.
+     */
+    public void genDirectCall(RiResolvedMethod target, Value[] args) {
+        invokeDirect(target, args, target.holder(), -1, null);
+    }
+
     private void appendInvoke(int opcode, RiMethod target, Value[] args, boolean isStatic, int cpi, RiConstantPool constantPool) {
         CiKind resultType = returnKind(target);
         Value result = append(new Invoke(opcode, resultType.stackKind(), args, isStatic, target, target.signature().returnType(compilation.method.holder()), null));
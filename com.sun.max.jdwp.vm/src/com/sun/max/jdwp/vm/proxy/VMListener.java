@@ -83,4 +83,16 @@ public interface VMListener {
      * @param location the code location specifying the current instruction pointer of the thread, i.e. the code location after the single step was made
      */
     void singleStepMade(ThreadProvider thread, JdwpCodeLocation location);
+
+    /**
+     * This method is called before the events caused by a single stop of the VM are reported. Together with
+     * {@link #eventsEnd()} it brackets all calls made to listeners for that stop, so that the events
+     * can be delivered to the debugger as one composite packet.
+     */
+    void eventsBegin();
+
+    /**
+     * This method is called after all events caused by a single stop of the VM have been reported.
+     */
+    void eventsEnd();
 }
@@ -22,7 +22,6 @@
  */
 package com.sun.max.jdwp.handlers;
 
-import java.io.IOException;
 import java.util.List;
 import java.util.logging.Logger;
 
@@ -111,17 +110,10 @@ public abstract class JDWPEventRequest<EventsCommon_Type extends Composite.Event
         }
 
         LOGGER.info("Event occurred (suspended: " + suspendPolicy + "): " + this);
-        final Composite.Reply r = new Composite.Reply();
-        r.suspendPolicy = suspendPolicy;
-        r.events = new Composite.Events[1];
-        r.events[0] = new Composite.Events();
-        r.events[0].eventKind = this.eventKind();
-        r.events[0].aEventsCommon = eventData;
-        try {
-            sender.sendCommand(r);
-        } catch (IOException e) {
-            LOGGER.severe("Could not send event, because of exception: " + e);
-        }
+        final Composite.Events event = new Composite.Events();
+        event.eventKind = this.eventKind();
+        event.aEventsCommon = eventData;
+        session.sendEvent(sender, suspendPolicy, event);
     }
 
     public static class ClassPrepare extends JDWPEventRequest<Composite.Events.ClassUnload> {
@@ -286,6 +278,11 @@ public abstract class JDWPEventRequest<EventsCommon_Type extends Composite.Event
             @Override
             public void breakpointHit(ThreadProvider thread, JdwpCodeLocation loc) {
 
+                // Every breakpoint request sees every hit; method IDs are assigned per provider object, so a hit in
+                // another method can be rejected without translating its location.
+                if (loc.method() != codeLocation.method()) {
+                    return;
+                }
                 Logger.getLogger(Breakpoint.class.getName()).info("Breakpoint was hit by thread " + thread + " on location " + loc);
 
                 final JDWPLocation locationHit = session().fromCodeLocation(loc);
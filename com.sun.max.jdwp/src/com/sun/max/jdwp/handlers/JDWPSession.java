@@ -22,8 +22,11 @@
  */
 package com.sun.max.jdwp.handlers;
 
+import java.io.IOException;
+import java.util.ArrayList;
 import java.util.HashMap;
 import java.util.IdentityHashMap;
+import java.util.List;
 import java.util.Map;
 import java.util.logging.Logger;
 
@@ -50,7 +53,9 @@ import com.sun.max.jdwp.data.ID.ThreadID;
 import com.sun.max.jdwp.data.JDWPException;
 import com.sun.max.jdwp.data.JDWPLocation;
 import com.sun.max.jdwp.data.JDWPNotImplementedException;
+import com.sun.max.jdwp.data.JDWPSender;
 import com.sun.max.jdwp.data.JDWPValue;
+import com.sun.max.jdwp.protocol.EventCommands.Composite;
 import com.sun.max.jdwp.vm.core.Provider;
 import com.sun.max.jdwp.vm.proxy.ArrayProvider;
 import com.sun.max.jdwp.vm.proxy.ArrayTypeProvider;
@@ -68,6 +73,7 @@ import com.sun.max.jdwp.vm.proxy.StringProvider;
 import com.sun.max.jdwp.vm.proxy.ThreadGroupProvider;
 import com.sun.max.jdwp.vm.proxy.ThreadProvider;
 import com.sun.max.jdwp.vm.proxy.VMAccess;
+import com.sun.max.jdwp.vm.proxy.VMListener;
 import com.sun.max.jdwp.vm.proxy.VMValue;
 
 /**
@@ -89,6 +95,32 @@ public class JDWPSession {
     private Map<FrameProvider, ThreadProvider> frameToThread;
     private long lastID;
 
+    /**
+     * Events that occurred while a batch was open or while events were held, in the order they occurred.
+     */
+    private final List<Composite.Events> pendingEvents = new ArrayList<Composite.Events>();
+    private byte pendingSuspendPolicy;
+    private JDWPSender pendingSender;
+    private int eventBatchDepth;
+    private boolean eventsHeld;
+
+    /**
+     * Opens an event batch for every stop of the VM so that all events reported for it, e.g. several breakpoint
+     * requests matching the same location together with a single step, reach the debugger in one composite packet.
+     */
+    private final VMListener eventBatcher = new VMAdapter() {
+
+        @Override
+        public void eventsBegin() {
+            beginEventBatch();
+        }
+
+        @Override
+        public void eventsEnd() {
+            endEventBatch();
+        }
+    };
+
     public JDWPSession(VMAccess vm) {
         assert vm != null : "Virtual machine abstraction must not be null";
         this.vm = vm;
@@ -97,6 +129,7 @@ public class JDWPSession {
         methodToReferenceType = new IdentityHashMap<MethodProvider, ReferenceTypeProvider>();
         fieldToReferenceType = new IdentityHashMap<FieldProvider, ReferenceTypeProvider>();
         frameToThread = new IdentityHashMap<FrameProvider, ThreadProvider>();
+        vm.addListener(eventBatcher);
     }
 
     public static int getValueTypeTag(VMValue.Type type) {
@@ -136,18 +169,74 @@ public class JDWPSession {
      * All events should be hold back until {@link releaseEvents()} is called.
      * @throws JDWPException
      */
-    public void holdEvents() throws JDWPException {
-        // TODO: Add implementation.
-        throw new JDWPNotImplementedException();
+    public synchronized void holdEvents() throws JDWPException {
+        eventsHeld = true;
     }
 
     /**
      * All events that were hold back because of a call to {@link holdEvents()} should be set free.
      * @throws JDWPException
      */
-    public void releaseEvents() throws JDWPException {
-        // TODO: Add implementation.
-        throw new JDWPNotImplementedException();
+    public synchronized void releaseEvents() throws JDWPException {
+        eventsHeld = false;
+        flushEvents();
+    }
+
+    /**
+     * Starts collecting events instead of sending each of them in a packet of its own. Batches may be nested;
+     * the collected events are sent when the outermost batch is ended.
+     */
+    public synchronized void beginEventBatch() {
+        eventBatchDepth++;
+    }
+
+    /**
+     * Ends an event batch started by {@link #beginEventBatch()}.
+     */
+    public synchronized void endEventBatch() {
+        assert eventBatchDepth > 0 : "unbalanced event batch";
+        eventBatchDepth--;
+        flushEvents();
+    }
+
+    /**
+     * Reports an event to the debugger. The event is sent immediately unless a batch is open or events are held,
+     * in which case it is sent later together with the other pending events.
+     *
+     * @param sender the channel over which the event is sent
+     * @param suspendPolicy the suspend policy of the request that caused the event
+     * @param event the event
+     */
+    public synchronized void sendEvent(JDWPSender sender, byte suspendPolicy, Composite.Events event) {
+        if (pendingEvents.isEmpty()) {
+            pendingSuspendPolicy = suspendPolicy;
+        } else {
+            pendingSuspendPolicy = (byte) Math.max(pendingSuspendPolicy, suspendPolicy);
+        }
+        pendingEvents.add(event);
+        pendingSender = sender;
+        flushEvents();
+    }
+
+    /**
+     * Sends all pending events in one composite packet if no batch is open and events are not held. The packet
+     * carries the most restrictive suspend policy of its events, i.e. {@code ALL} if any of them
+     * suspended all threads.
+     */
+    private void flushEvents() {
+        if (eventBatchDepth > 0 || eventsHeld || pendingEvents.isEmpty()) {
+            return;
+        }
+        final Composite.Reply r = new Composite.Reply();
+        r.suspendPolicy = pendingSuspendPolicy;
+        r.events = pendingEvents.toArray(new Composite.Events[pendingEvents.size()]);
+        pendingEvents.clear();
+        try {
+            pendingSender.sendCommand(r);
+        } catch (IOException e) {
+            LOGGER.severe("Could not send " + r.events.length + " event(s), because of exception: " + e);
+        }
+        pendingSender = null;
     }
 
     /**
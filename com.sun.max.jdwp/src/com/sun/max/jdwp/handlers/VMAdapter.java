@@ -49,4 +49,10 @@ public class VMAdapter implements VMListener {
 
     public void singleStepMade(ThreadProvider thread, JdwpCodeLocation location) {
     }
+
+    public void eventsBegin() {
+    }
+
+    public void eventsEnd() {
+    }
 }
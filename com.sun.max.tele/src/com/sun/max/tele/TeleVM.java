@@ -1694,10 +1694,38 @@ public abstract class TeleVM implements MaxVM {
         }
     }
 
+    /**
+     * Informs all JDWP listeners that the events caused by the current VM state change are about to be reported.
+     */
+    private void fireJDWPEventsBegin() {
+        for (VMListener listener : jdwpListeners) {
+            listener.eventsBegin();
+        }
+    }
+
+    /**
+     * Informs all JDWP listeners that all events caused by the current VM state change have been reported.
+     */
+    private void fireJDWPEventsEnd() {
+        for (VMListener listener : jdwpListeners) {
+            listener.eventsEnd();
+        }
+    }
+
     private final MaxVMStateListener jdwpStateModel = new MaxVMStateListener() {
 
         public void stateChanged(MaxVMState maxVMState) {
             Trace.begin(TRACE_VALUE, tracePrefix() + "handling " + maxVMState);
+            fireJDWPEventsBegin();
+            try {
+                fireJDWPStateEvents(maxVMState);
+            } finally {
+                fireJDWPEventsEnd();
+            }
+            Trace.end(TRACE_VALUE, tracePrefix() + "handling " + maxVMState);
+        }
+
+        private void fireJDWPStateEvents(MaxVMState maxVMState) {
             fireJDWPThreadEvents();
             switch(maxVMState.processState()) {
                 case TERMINATED:
@@ -1720,7 +1748,6 @@ public abstract class TeleVM implements MaxVM {
                     LOGGER.info("VM continued to RUN!");
                     break;
             }
-            Trace.end(TRACE_VALUE, tracePrefix() + "handling " + maxVMState);
         }
     };
 
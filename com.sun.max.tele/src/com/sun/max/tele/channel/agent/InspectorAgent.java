@@ -88,6 +88,7 @@ public class InspectorAgent {
                 try {
                     Trace.line(1, "waiting for connection");
                     final Socket sock = server.accept();
+                    sock.setTcpNoDelay(true);
                     Trace.line(1, "connection accepted on " + sock.getLocalPort() + " from " + sock.getInetAddress());
                     final Handler handler = new Handler(sock);
                     handler.start();
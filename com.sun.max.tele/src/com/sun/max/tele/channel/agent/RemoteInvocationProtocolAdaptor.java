@@ -137,7 +137,7 @@ public abstract class RemoteInvocationProtocolAdaptor {
                 } else {
                     // allocate and read (input or input/output array)
                     data = new byte[length];
-                    in.read(data);
+                    in.readFully(data);
                 }
                 result[index] = data;
             } else if (klass == String[].class) {
@@ -101,8 +101,20 @@ public class TeleChannelDataIOProtocolImpl implements TeleChannelDataIOProtocol
 
     @Override
     public boolean activateWatchpoint(long start, long size, boolean after, boolean read, boolean write, boolean exec) {
-        unimplemented("activateWatchpoint");
-        return false;
+        try {
+            out.writeUTF("activateWatchpoint");
+            out.writeLong(start);
+            out.writeLong(size);
+            out.writeBoolean(after);
+            out.writeBoolean(read);
+            out.writeBoolean(write);
+            out.writeBoolean(exec);
+            out.flush();
+            return in.readBoolean();
+        } catch (IOException ex) {
+            TeleError.unexpected(ex);
+            return false;
+        }
     }
 
     @Override
@@ -172,11 +184,12 @@ public class TeleChannelDataIOProtocolImpl implements TeleChannelDataIOProtocol
         try {
             out.writeUTF("readBytes");
             out.writeLong(src);
-            outByteArray(ArrayMode.OUT, dst);
-            out.writeInt(dstOffset);
+            // Only the requested bytes travel: the callee fills an array of exactly 'length' bytes from offset 0
+            outOutputArray(length);
+            out.writeInt(0);
             out.writeInt(length);
             out.flush();
-            inByteArray(dst, dstOffset, length);
+            in.readFully(dst, dstOffset, length);
             final int result = in.readInt();
             return result;
         } catch (IOException ex) {
@@ -191,16 +204,16 @@ public class TeleChannelDataIOProtocolImpl implements TeleChannelDataIOProtocol
         try {
             out.writeUTF("readRegisters");
             out.writeLong(threadId);
-            outByteArray(ArrayMode.OUT, integerRegisters);
+            outOutputArray(integerRegistersSize);
             out.writeInt(integerRegistersSize);
-            outByteArray(ArrayMode.OUT, floatingPointRegisters);
+            outOutputArray(floatingPointRegistersSize);
             out.writeInt(floatingPointRegistersSize);
-            outByteArray(ArrayMode.OUT, stateRegisters);
+            outOutputArray(stateRegistersSize);
             out.writeInt(stateRegistersSize);
             out.flush();
-            inByteArray(integerRegisters, 0, integerRegistersSize);
-            inByteArray(floatingPointRegisters, 0, floatingPointRegistersSize);
-            inByteArray(stateRegisters, 0, stateRegistersSize);
+            in.readFully(integerRegisters, 0, integerRegistersSize);
+            in.readFully(floatingPointRegisters, 0, floatingPointRegistersSize);
+            in.readFully(stateRegisters, 0, stateRegistersSize);
             return in.readBoolean();
         } catch (IOException ex) {
             TeleError.unexpected(ex);
@@ -340,8 +353,8 @@ public class TeleChannelDataIOProtocolImpl implements TeleChannelDataIOProtocol
         try {
             out.writeUTF("writeBytes");
             out.writeLong(dst);
-            outByteArray(ArrayMode.IN, src);
-            out.writeInt(srcOffset);
+            outInputArray(src, srcOffset, length);
+            out.writeInt(0);
             out.writeInt(length);
             out.flush();
             return in.readInt();
@@ -369,9 +382,9 @@ public class TeleChannelDataIOProtocolImpl implements TeleChannelDataIOProtocol
         try {
             out.writeUTF("readThreads");
             out.writeInt(size);
-            outByteArray(ArrayMode.OUT, gatherThreadData);
+            outOutputArray(size);
             out.flush();
-            inByteArray(gatherThreadData, 0, size);
+            in.readFully(gatherThreadData, 0, size);
             return in.readInt();
         } catch (IOException ex) {
             TeleError.unexpected(ex);
@@ -379,19 +392,24 @@ public class TeleChannelDataIOProtocolImpl implements TeleChannelDataIOProtocol
         }
     }
 
-    private void outByteArray(ArrayMode mode, byte[] array) throws IOException {
-        out.writeInt(mode.ordinal());
-        // write b.length first so callee can allocate
-        out.writeInt(array.length);
-        if (mode != ArrayMode.OUT) {
-            out.write(array);
-        }
+    /**
+     * Passes the slice {@code [offset, offset + length)} of an {@link ArrayMode#IN in} array parameter, which the
+     * callee sees as an array of {@code length} bytes.
+     */
+    private void outInputArray(byte[] array, int offset, int length) throws IOException {
+        out.writeInt(ArrayMode.IN.ordinal());
+        // write length first so callee can allocate
+        out.writeInt(length);
+        out.write(array, offset, length);
     }
 
-    private void inByteArray(byte[] dst, int dstOffset, int length) throws IOException {
-        byte[] result = new byte[dst.length];
-        in.readFully(result);
-        System.arraycopy(result, dstOffset, dst, dstOffset, length);
+    /**
+     * Passes an {@link ArrayMode#OUT out} array parameter of a given length. The callee allocates its own array
+     * and returns all of it, so the length should be no more than the number of bytes the caller needs back.
+     */
+    private void outOutputArray(int length) throws IOException {
+        out.writeInt(ArrayMode.OUT.ordinal());
+        out.writeInt(length);
     }
 
 
@@ -406,8 +424,4 @@ public class TeleChannelDataIOProtocolImpl implements TeleChannelDataIOProtocol
         }
     }
 
-    private void unimplemented(String name) {
-        TeleError.unimplemented(getClass().getName() + "." + name);
-    }
-
 }
@@ -46,6 +46,8 @@ public class TCPTeleChannelProtocol extends TeleChannelDataIOProtocolAdaptor {
         Trace.line(1, "connecting to agent on " + host + ":" + port);
         try {
             socket = new Socket(host, port);
+            // Every call is a small request awaiting a small response, which Nagle's algorithm would delay
+            socket.setTcpNoDelay(true);
             Trace.line(1, "connected");
             setStreams(new BufferedInputStream(socket.getInputStream()), new BufferedOutputStream(socket.getOutputStream()));
         } catch (Exception ex) {
@@ -25,6 +25,9 @@ package com.sun.max.tele.debug.dump;
 import static com.oracle.max.elf.ELFProgramHeaderTable.*;
 
 import java.io.*;
+import java.nio.*;
+import java.nio.channels.*;
+import java.util.*;
 
 import com.oracle.max.elf.*;
 import com.sun.max.program.*;
@@ -42,12 +45,54 @@ public class ELFDumpTeleChannelProtocolAdaptor extends TeleChannelDataIOProtocol
     protected int tlaSize;
     public boolean bigEndian;
     protected RandomAccessFile dumpRaf;
+    protected FileChannel dumpChannel;
     protected ELFHeader header;
     protected ELFProgramHeaderTable programHeaderTable;
     protected ELFSymbolLookup symbolLookup;
     protected MaxVM teleVM;
     protected static final String HEAP_SYMBOL_NAME = "theHeap";  // defined in image.c, holds the base address of the boot heap
 
+    /**
+     * Size of the windows in which segments are mapped. A single {@link MappedByteBuffer} cannot exceed 2GB.
+     */
+    private static final long MAP_WINDOW_SIZE = 1L << 30;
+
+    /**
+     * A {@code PT_LOAD} segment of the dump. The file-backed part of the segment is memory mapped on demand in
+     * windows of {@link #MAP_WINDOW_SIZE} bytes, the remainder up to the memory size of the segment reads as zero.
+     */
+    protected static final class Segment {
+        final long start;
+        final long end;
+        final long fileOffset;
+        final long fileSize;
+        private final MappedByteBuffer[] windows;
+
+        Segment(ELFProgramHeaderTable.Entry64 entry) {
+            start = entry.p_vaddr;
+            end = entry.p_vaddr + entry.p_memsz;
+            fileOffset = entry.p_offset;
+            fileSize = entry.p_filesz;
+            windows = new MappedByteBuffer[(int) ((fileSize + MAP_WINDOW_SIZE - 1) / MAP_WINDOW_SIZE)];
+        }
+
+        synchronized MappedByteBuffer window(FileChannel channel, int index) throws IOException {
+            MappedByteBuffer window = windows[index];
+            if (window == null) {
+                final long offset = index * MAP_WINDOW_SIZE;
+                window = channel.map(FileChannel.MapMode.READ_ONLY, fileOffset + offset, Math.min(MAP_WINDOW_SIZE, fileSize - offset));
+                windows[index] = window;
+            }
+            return window;
+        }
+    }
+
+    /**
+     * The segments with file contents, sorted by start address. Segments in a core file do not overlap.
+     */
+    protected Segment[] segments;
+    private Segment lastSegment;
+
 
     protected ELFDumpTeleChannelProtocolAdaptor(MaxVM teleVM, File vm, File dump) {
         this.teleVM = teleVM;
@@ -58,6 +103,8 @@ public class ELFDumpTeleChannelProtocolAdaptor extends TeleChannelDataIOProtocol
             dumpRaf = new RandomAccessFile(dump, "r");
             this.header = ELFLoader.readELFHeader(dumpRaf);
             this.programHeaderTable = ELFLoader.readPHT(dumpRaf, header);
+            dumpChannel = dumpRaf.getChannel();
+            indexSegments();
             // This is not needed currently as we cannot look up symbols from shared libraries.
             //symbolLookup = new ELFSymbolLookup(new File(vm.getParent(), "libjvm.so"));
         } catch (Exception ex) {
@@ -72,6 +119,86 @@ public class ELFDumpTeleChannelProtocolAdaptor extends TeleChannelDataIOProtocol
         return true;
     }
 
+    private void indexSegments() {
+        final ArrayList<Segment> list = new ArrayList<Segment>();
+        for (ELFProgramHeaderTable.Entry entry : programHeaderTable.entries) {
+            ELFProgramHeaderTable.Entry64 entry64 = (ELFProgramHeaderTable.Entry64) entry;
+            if (entry64.p_type == PT_LOAD && entry64.p_filesz != 0) {
+                list.add(new Segment(entry64));
+            }
+        }
+        segments = list.toArray(new Segment[list.size()]);
+        Arrays.sort(segments, new Comparator<Segment>() {
+            public int compare(Segment a, Segment b) {
+                return Address.fromLong(a.start).compareTo(Address.fromLong(b.start));
+            }
+        });
+    }
+
+    /**
+     * Finds the segment containing a given address by binary search.
+     *
+     * @return the segment containing {@code addr} or {@code null} if there is none
+     */
+    protected Segment findSegment(long addr) {
+        final Address address = Address.fromLong(addr);
+        final Segment last = lastSegment;
+        if (last != null && address.greaterEqual(Address.fromLong(last.start)) && address.lessThan(Address.fromLong(last.end))) {
+            return last;
+        }
+        int low = 0;
+        int high = segments.length - 1;
+        while (low <= high) {
+            final int mid = (low + high) >>> 1;
+            final Segment segment = segments[mid];
+            if (address.lessThan(Address.fromLong(segment.start))) {
+                high = mid - 1;
+            } else if (address.greaterEqual(Address.fromLong(segment.end))) {
+                low = mid + 1;
+            } else {
+                lastSegment = segment;
+                return segment;
+            }
+        }
+        return null;
+    }
+
+    /**
+     * Copies bytes from the mapped segments of the dump into a buffer, starting at the buffer's position.
+     * The copy stops at the first address that is not covered by a segment.
+     *
+     * @return the number of bytes copied
+     */
+    protected int readMapped(long src, ByteBuffer dst, int length) {
+        int n = 0;
+        try {
+            while (n < length) {
+                final Segment segment = findSegment(src + n);
+                if (segment == null) {
+                    break;
+                }
+                final long offset = src + n - segment.start;
+                int chunk = (int) Math.min(length - n, segment.end - (src + n));
+                if (offset < segment.fileSize) {
+                    final int windowOffset = (int) (offset % MAP_WINDOW_SIZE);
+                    final ByteBuffer window = segment.window(dumpChannel, (int) (offset / MAP_WINDOW_SIZE)).duplicate();
+                    chunk = Math.min(chunk, window.capacity() - windowOffset);
+                    window.limit(windowOffset + chunk);
+                    window.position(windowOffset);
+                    dst.put(window);
+                } else {
+                    for (int i = 0; i < chunk; i++) {
+                        dst.put((byte) 0);
+                    }
+                }
+                n += chunk;
+            }
+        } catch (IOException ex) {
+            TeleError.unexpected("failed to map dump file segment", ex);
+        }
+        return n;
+    }
+
     protected static class NoteEntryHandler {
         /**
          * OS-specific processing a NOTE entry.
@@ -97,8 +224,8 @@ public class ELFDumpTeleChannelProtocolAdaptor extends TeleChannelDataIOProtocol
             }
         }
         try {
-            dumpRaf.seek(noteSectionEntry.p_offset);
-            final ELFDataInputStream dis = new ELFDataInputStream(header, dumpRaf);
+            final ByteBuffer noteBuffer = dumpChannel.map(FileChannel.MapMode.READ_ONLY, noteSectionEntry.p_offset, noteSectionEntry.p_filesz);
+            final ELFDataInputStream dis = new ELFDataInputStream(header, noteBuffer);
             final long size = noteSectionEntry.p_filesz;
             long readLength = 0;
             while (readLength < size) {
@@ -243,17 +370,18 @@ public class ELFDumpTeleChannelProtocolAdaptor extends TeleChannelDataIOProtocol
 
     @Override
     public int readBytes(long src, byte[] dst, int dstOffset, int length) {
-        final ELFProgramHeaderTable.Entry64 entry64 = findAddress(src);
-        if (entry64 == null) {
-            return 0;
-        }
-        try {
-            dumpRaf.seek(entry64.p_offset + (src - entry64.p_vaddr));
-            return dumpRaf.read(dst, dstOffset, length);
-        } catch (IOException ex) {
-            return 0;
-        }
+        return readMapped(src, ByteBuffer.wrap(dst, dstOffset, length), length);
+    }
 
+    /**
+     * Copies straight from the mapped dump file into {@code dst}, without an intermediate array.
+     */
+    @Override
+    public int readBytes(long src, ByteBuffer dst, int dstOffset, int length) {
+        final ByteBuffer target = dst.duplicate();
+        target.limit(dstOffset + length);
+        target.position(dstOffset);
+        return readMapped(src, target, length);
     }
 
     @Override
@@ -31,6 +31,8 @@ import com.sun.max.tele.channel.*;
 import com.sun.max.tele.channel.natives.*;
 import com.sun.max.tele.debug.*;
 import com.sun.max.tele.debug.unix.*;
+import com.sun.max.tele.heap.*;
+import com.sun.max.tele.util.*;
 import com.sun.max.util.*;
 import com.sun.max.vm.hosted.*;
 
@@ -76,6 +78,29 @@ public class LinuxNativeTeleChannelProtocol extends UnixNativeTeleChannelProtoco
         return 1;
     }
 
+    /**
+     * Attaches to an existing VM process, typically a snapshot created with the VM's {@code -XX:ForkSnapshotSignal}
+     * option. The address of the boot heap must then be given with the {@value VmHeapAccess#HEAP_ADDRESS_PROPERTY}
+     * system property, as the VM process has no agent connection to report it.
+     */
+    @Override
+    public boolean attach(int id) {
+        leaderTask = LinuxTask.attach(id);
+        return leaderTask != null;
+    }
+
+    @Override
+    public long getBootHeapStart() {
+        if (agent != null) {
+            return super.getBootHeapStart();
+        }
+        final long heapAddress = VmHeapAccess.heapAddressOption();
+        if (heapAddress == 0) {
+            TeleError.unexpected("the boot heap address of an attached VM process must be specified with -D" + VmHeapAccess.HEAP_ADDRESS_PROPERTY);
+        }
+        return heapAddress;
+    }
+
     @Override
     public int readBytes(long src, byte[] dst, int dstOffset, int length) {
         return leaderTask.readBytes(src, dst, false, dstOffset, length);
@@ -197,6 +222,27 @@ public class LinuxNativeTeleChannelProtocol extends UnixNativeTeleChannelProtoco
         }
     }
 
+    @Override
+    public boolean activateWatchpoint(long start, long size, boolean after, boolean read, boolean write, boolean exec) {
+        // Data watchpoints set in the debug registers always trap after the access
+        return leaderTask.activateWatchpoint(start, size, read, write, exec);
+    }
+
+    @Override
+    public boolean deactivateWatchpoint(long start, long size) {
+        return leaderTask.deactivateWatchpoint(start, size);
+    }
+
+    @Override
+    public long readWatchpointAddress() {
+        return leaderTask.readWatchpointAddress();
+    }
+
+    @Override
+    public int readWatchpointAccessCode() {
+        return leaderTask.readWatchpointAccessCode();
+    }
+
     private static native void nativeGatherThreads(long pid, Object teleProcess, Object threadList, long tlaList);
 
 
@@ -206,6 +206,25 @@ public final class LinuxTask {
         });
     }
 
+    private static native boolean nativeAttach(int pid);
+
+    /**
+     * Attaches to all the tasks of an existing process, leaving them stopped.
+     *
+     * @param pid the process to attach to
+     * @return the leader task of the process or {@code null} if attaching failed
+     */
+    public static LinuxTask attach(final int pid) {
+        return execute(new Function<LinuxTask>() {
+            public LinuxTask call() {
+                if (!nativeAttach(pid)) {
+                    return null;
+                }
+                return new LinuxTask(pid, pid);
+            }
+        });
+    }
+
     private static native boolean nativeDetach(int tgid, int tid);
 
     public void detach() throws IOException {
@@ -404,6 +423,55 @@ public final class LinuxTask {
         });
     }
 
+    private static native boolean nativeActivateWatchpoint(int tgid, int tid, long address, long size, boolean read, boolean write, boolean exec);
+
+    /**
+     * Activates a hardware watchpoint in all tasks of this task's process.
+     *
+     * @return {@code false} if there are not enough free hardware watchpoint slots to cover the region
+     *         or the debug registers could not be updated
+     */
+    public boolean activateWatchpoint(final long address, final long size, final boolean read, final boolean write, final boolean exec) {
+        return execute(new Function<Boolean>() {
+            public Boolean call() throws Exception {
+                return nativeActivateWatchpoint(tgid, tid, address, size, read, write, exec);
+            }
+        });
+    }
+
+    private static native boolean nativeDeactivateWatchpoint(int tgid, int tid, long address, long size);
+
+    public boolean deactivateWatchpoint(final long address, final long size) {
+        return execute(new Function<Boolean>() {
+            public Boolean call() throws Exception {
+                return nativeDeactivateWatchpoint(tgid, tid, address, size);
+            }
+        });
+    }
+
+    private static native long nativeReadWatchpointAddress(int tgid);
+
+    /**
+     * Gets the start of the watched region that caused the current stop, or 0 if no task is stopped at a watchpoint.
+     */
+    public long readWatchpointAddress() {
+        return execute(new Function<Long>() {
+            public Long call() throws Exception {
+                return nativeReadWatchpointAddress(tgid);
+            }
+        });
+    }
+
+    private static native int nativeReadWatchpointAccessCode(int tgid);
+
+    public int readWatchpointAccessCode() {
+        return execute(new Function<Integer>() {
+            public Integer call() throws Exception {
+                return nativeReadWatchpointAccessCode(tgid);
+            }
+        });
+    }
+
     public void close() {
         if (memory != null) {
             try {
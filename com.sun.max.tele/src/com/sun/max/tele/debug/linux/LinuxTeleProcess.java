@@ -22,8 +22,11 @@
  */
 package com.sun.max.tele.debug.linux;
 
+import static com.sun.max.platform.Platform.*;
+
 import java.io.*;
 
+import com.sun.max.lang.*;
 import com.sun.max.platform.*;
 import com.sun.max.tele.*;
 import com.sun.max.tele.debug.*;
@@ -55,4 +58,15 @@ public final class LinuxTeleProcess extends UnixTeleProcessAdaptor {
         return new LinuxTeleNativeThread(this, params);
     }
 
+    /**
+     * Watchpoints are implemented with the hardware debug registers, of which x86 and most AArch64
+     * implementations have four. A watchpoint on a region that is larger than 8 bytes or not naturally
+     * aligned needs more than one of them, in which case activation fails once the registers are exhausted.
+     */
+    @Override
+    public int platformWatchpointCount() {
+        final ISA isa = platform().isa;
+        return isa == ISA.AMD64 || isa == ISA.Aarch64 ? 4 : 0;
+    }
+
 }
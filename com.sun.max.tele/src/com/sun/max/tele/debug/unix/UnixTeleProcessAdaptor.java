@@ -72,8 +72,8 @@ public abstract class UnixTeleProcessAdaptor extends TeleProcess {
             } catch (OSExecutionRequestException e) {
                 throw new BootImageException("Error resuming VM after starting it", e);
             }
-        } else {
-            protocol.attach(id);
+        } else if (!protocol.attach(id)) {
+            throw new BootImageException("Could not attach to VM process " + id);
         }
     }
 
@@ -298,6 +298,13 @@ public final class VmHeapAccess extends AbstractVmHolder implements MaxHeap, VmA
             }
         }
         updateTracer.begin();
+
+        // Drop cached object information first if a GC has started since the last update, since the
+        // region updates below already depend on it.
+        final long gcStartedCount = fields().InspectableHeapInfo_gcStartedCounter.readLong(vm());
+        final HeapPhase heapPhase = HeapPhase.values()[fields().InspectableHeapInfo_heapPhaseOrdinal.readInt(vm())];
+        objects().objectCache().update(gcStartedCount, heapPhase);
+
         // Suspend checking for heap containment of object origin addresses.
         updatingHeapMemoryRegions = true;
 
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package com.sun.max.tele.object;
+
+import java.util.*;
+
+import com.sun.max.unsafe.*;
+import com.sun.max.vm.heap.*;
+
+/**
+ * A cache of facts about objects in VM heap memory that cannot change unless the heap is collected: that a
+ * particular origin holds a {@linkplain ObjectStatus#LIVE live} object, and where that object's hub is.
+ * Establishing either remotely takes several small reads of VM memory, which dominates the cost of browsing
+ * large collections.
+ * <p>
+ * Entries are tagged implicitly with the GC epoch, i.e. the number of collections started in the VM: the
+ * whole cache is dropped in one step when a new collection is observed, and nothing is cached while a
+ * collection is in progress. Only positive facts are recorded, since an origin that holds no object
+ * can become a live object through allocation without any collection taking place.
+ */
+public final class RemoteObjectCache {
+
+    /**
+     * Upper bound on the number of origins remembered; the cache is dropped when it is exceeded.
+     */
+    private static final int MAX_ENTRIES = 1 << 20;
+
+    private final Set<Long> liveOrigins = new HashSet<Long>();
+
+    private final Map<Long, Long> hubOrigins = new HashMap<Long, Long>();
+
+    private long gcEpoch = -1L;
+
+    private boolean enabled = false;
+
+    /**
+     * Brings the cache up to date with the memory management state of the VM.
+     *
+     * @param gcStartedCount the number of collections that have started in the VM
+     * @param phase the current phase of the heap
+     */
+    public synchronized void update(long gcStartedCount, HeapPhase phase) {
+        if (gcStartedCount != gcEpoch || phase.isCollecting()) {
+            flush();
+        }
+        gcEpoch = gcStartedCount;
+        enabled = !phase.isCollecting();
+    }
+
+    /**
+     * Drops all cached information.
+     */
+    public synchronized void flush() {
+        liveOrigins.clear();
+        hubOrigins.clear();
+    }
+
+    /**
+     * @return whether {@code origin} is known to hold a live object in the current GC epoch
+     */
+    public synchronized boolean isLive(Address origin) {
+        return enabled && liveOrigins.contains(origin.toLong());
+    }
+
+    /**
+     * Records that {@code origin} holds a live object.
+     */
+    public synchronized void recordLive(Address origin) {
+        if (enabled) {
+            if (liveOrigins.size() >= MAX_ENTRIES) {
+                flush();
+            }
+            liveOrigins.add(origin.toLong());
+        }
+    }
+
+    /**
+     * @return the origin of the hub of the live object at {@code origin} or {@link Address#zero()} if not cached
+     */
+    public synchronized Address hubOrigin(Address origin) {
+        if (enabled) {
+            final Long hubOrigin = hubOrigins.get(origin.toLong());
+            if (hubOrigin != null) {
+                return Address.fromLong(hubOrigin);
+            }
+        }
+        return Address.zero();
+    }
+
+    /**
+     * Records the origin of the live hub of the live object at {@code origin}, after following any forwarder.
+     */
+    public synchronized void recordHubOrigin(Address origin, Address hubOrigin) {
+        if (enabled) {
+            if (hubOrigins.size() >= MAX_ENTRIES) {
+                flush();
+            }
+            hubOrigins.put(origin.toLong(), hubOrigin.toLong());
+        }
+    }
+}
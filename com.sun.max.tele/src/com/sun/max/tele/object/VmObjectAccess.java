@@ -109,6 +109,8 @@ public final class VmObjectAccess extends AbstractVmHolder implements TeleVMCach
 
     private final TeleObjectFactory teleObjectFactory;
 
+    private final RemoteObjectCache objectCache = new RemoteObjectCache();
+
     private Word cachedDynamicHubHubWord = null;
 
     private Word cachedStaticHubHubWord = null;
@@ -176,6 +178,13 @@ public final class VmObjectAccess extends AbstractVmHolder implements TeleVMCach
         lastUpdateEpoch = epoch;
     }
 
+    /**
+     * @return the cache of information about heap objects that remains valid until the next GC
+     */
+    public RemoteObjectCache objectCache() {
+        return objectCache;
+    }
+
     public String entityName() {
         return entityName;
     }
@@ -205,10 +214,18 @@ public final class VmObjectAccess extends AbstractVmHolder implements TeleVMCach
         if (origin.isZero() || origin.equals(zappedMarker)) {
             return DEAD;
         }
+        if (objectCache.isLive(origin)) {
+            return LIVE;
+        }
         final MaxEntityMemoryRegion<?> maxMemoryRegion = vm().addressSpace().find(origin);
         if (maxMemoryRegion != null && maxMemoryRegion.owner() instanceof VmObjectHoldingRegion<?>) {
             final VmObjectHoldingRegion<?> objectHoldingRegion = (VmObjectHoldingRegion<?>) maxMemoryRegion.owner();
-            return objectHoldingRegion.objectReferenceManager().objectStatusAt(origin);
+            final ObjectStatus status = objectHoldingRegion.objectReferenceManager().objectStatusAt(origin);
+            // Objects in the code cache can be evicted without a GC, so only heap objects are cached
+            if (status.isLive() && objectHoldingRegion instanceof VmHeapRegion) {
+                objectCache.recordLive(origin);
+            }
+            return status;
         }
         Trace.line(TRACE_VALUE + 1, tracePrefix() + "origin in unknown region @" + origin.to0xHexString());
         return DEAD;
@@ -939,6 +939,12 @@ public final class RemoteReferenceScheme extends AbstractVMScheme implements Ref
         if (remoteRef instanceof LocalObjectRemoteReference) {
             throw new UnsupportedOperationException();
         }
+        final RemoteObjectCache objectCache = vm.objects().objectCache();
+        final Address origin = remoteRef.toOrigin();
+        final Address cachedHubOrigin = objectCache.hubOrigin(origin);
+        if (cachedHubOrigin.isNotZero()) {
+            return fromOrigin(cachedHubOrigin.asPointer());
+        }
         final Address hubOrigin = Layout.readHubReferenceAsWord(remoteRef).asAddress();
         if (hubOrigin.isZero()) {
             return zero;
@@ -946,6 +952,9 @@ public final class RemoteReferenceScheme extends AbstractVMScheme implements Ref
         final ObjectStatus objectStatus = vm.objects().objectStatusAt(hubOrigin);
         switch(objectStatus) {
             case LIVE:
+                if (objectCache.isLive(origin) && objectCache.isLive(hubOrigin)) {
+                    objectCache.recordHubOrigin(origin, hubOrigin);
+                }
                 return fromOrigin(hubOrigin.asPointer());
             case FORWARDER:
                 final RemoteReference forwarderReference = vm.referenceManager().makeQuasiReference(hubOrigin);
@@ -58,23 +58,62 @@ public final class Memory {
      */
     public static final long ZAPPED_MARKER = 0xDEADBEEFCAFEBABEL;
 
+    /**
+     * Users of native memory, for the accounting done with {@code -XX:+NativeMemoryTracking}.
+     * The order must be kept in sync with memory.c.
+     */
+    public enum Category {
+        OTHER, GC, JNI, UNSAFE, SYNCHRONIZATION, LOGGING;
+
+        public static final Category[] VALUES = values();
+    }
+
+    public static final VMBooleanOption NativeMemoryTrackingOption = VMOptions.register(new VMBooleanOption("-XX:-NativeMemoryTracking",
+                    "Account for the native memory allocated by the VM per category, and report it at exit.") {
+        @Override
+        protected void beforeExit() {
+            if (getValue()) {
+                printNativeMemoryUsage();
+            }
+        }
+    }, MaxineVM.Phase.PRISTINE);
+
     @C_FUNCTION
-    private static native Pointer memory_allocate(Size size);
+    private static native Pointer memory_allocate_category(Size size, int category, boolean zero, boolean track);
+
+    @C_FUNCTION
+    private static native long memory_category_bytes(int category);
+
+    @C_FUNCTION
+    private static native long memory_category_blocks(int category);
 
     /**
-     * Allocates an aligned chunk of memory using a malloc(3)-like facility.
+     * Allocates an aligned, zeroed chunk of memory using a malloc(3)-like facility.
      *
      * @param size the size of the chunk of memory to be allocated
      * @return a pointer to the allocated chunk of memory or {@code Pointer.zero()} if allocation failed
      */
     public static Pointer allocate(Size size) {
+        return allocate(size, Category.OTHER, true);
+    }
+
+    /**
+     * Allocates an aligned chunk of memory using a malloc(3)-like facility.
+     *
+     * @param size the size of the chunk of memory to be allocated
+     * @param category the user of the chunk, for native memory tracking
+     * @param zero specifies if the chunk must be zeroed. Callers that initialize the whole chunk should pass
+     *            {@code false} to avoid paying for zeroing.
+     * @return a pointer to the allocated chunk of memory or {@code Pointer.zero()} if allocation failed
+     */
+    public static Pointer allocate(Size size, Category category, boolean zero) {
         if (size.toLong() < 0) {
             throw new IllegalArgumentException();
         }
         if (isHosted()) {
             return boxedAllocate(size);
         }
-        return memory_allocate(size);
+        return memory_allocate_category(size, category.ordinal(), zero, NativeMemoryTrackingOption.getValue());
     }
 
     @HOSTED_ONLY
@@ -93,7 +132,18 @@ public final class Memory {
      * @throws OutOfMemoryError if allocation failed or log message and VM termination if early in bootstrap
      */
     public static Pointer mustAllocate(Size size) throws OutOfMemoryError, IllegalArgumentException {
-        final Pointer result = isHosted() ? boxedAllocate(size) : memory_allocate(size);
+        return mustAllocate(size, Category.OTHER, true);
+    }
+
+    /**
+     * @param size the size of the chunk of memory to be allocated
+     * @param category the user of the chunk, for native memory tracking
+     * @param zero specifies if the chunk must be zeroed
+     * @return a pointer to the allocated chunk of memory
+     * @throws OutOfMemoryError if allocation failed or log message and VM termination if early in bootstrap
+     */
+    public static Pointer mustAllocate(Size size, Category category, boolean zero) throws OutOfMemoryError, IllegalArgumentException {
+        final Pointer result = isHosted() ? boxedAllocate(size) : memory_allocate_category(size, category.ordinal(), zero, NativeMemoryTrackingOption.getValue());
         if (result.isZero()) {
             if (MaxineVM.isPrimordialOrPristine()) {
                 MaxineVM.reportPristineMemoryFailure("unknown", "mustAllocate", size);
@@ -139,10 +189,70 @@ public final class Memory {
         }
     }
 
+    /**
+     * Number of bytes from which {@link #setBytes}, {@link #copyBytes} and {@link #equals} call into the C library,
+     * whose implementations use the widest vector instructions of the CPU. Below this, the call overhead dominates
+     * and the operations are done a word at a time in Java.
+     */
+    private static final int NATIVE_THRESHOLD = 256;
+
+    @C_FUNCTION
+    private static native void memory_set(Pointer pointer, Size numberOfBytes, int value);
+
+    @C_FUNCTION
+    private static native void memory_copy(Pointer fromPointer, Pointer toPointer, Size numberOfBytes);
+
+    @C_FUNCTION
+    private static native int memory_compare(Pointer pointer1, Pointer pointer2, Size numberOfBytes);
+
+    /**
+     * Gets the number of bytes of native memory in use by a category. Only memory allocated while
+     * {@code -XX:+NativeMemoryTracking} is enabled is accounted for.
+     */
+    public static long nativeMemoryInUse(Category category) {
+        return isHosted() ? 0L : memory_category_bytes(category.ordinal());
+    }
+
+    public static void printNativeMemoryUsage() {
+        Log.println("Native memory in use:");
+        long total = 0L;
+        for (Category category : Category.VALUES) {
+            final long bytes = memory_category_bytes(category.ordinal());
+            Log.print("    ");
+            Log.print(category.name());
+            Log.print(": ");
+            Log.print(bytes);
+            Log.print(" bytes in ");
+            Log.print(memory_category_blocks(category.ordinal()));
+            Log.println(" blocks");
+            total += bytes;
+        }
+        Log.print("    total: ");
+        Log.print(total);
+        Log.println(" bytes");
+    }
+
     @NO_SAFEPOINT_POLLS("speed")
     public static void setBytes(Pointer pointer, Size numberOfBytes, byte value) {
-        for (Offset i = Offset.zero(); i.lessThan(numberOfBytes.asOffset()); i = i.plus(1)) {
-            pointer.writeByte(i, value);
+        if (!isHosted() && numberOfBytes.greaterEqual(NATIVE_THRESHOLD)) {
+            memory_set(pointer, numberOfBytes, value);
+            return;
+        }
+        final Pointer end = pointer.plus(numberOfBytes);
+        Pointer p = pointer;
+        while (p.lessThan(end) && !p.isWordAligned()) {
+            p.writeByte(0, value);
+            p = p.plus(1);
+        }
+        final Word pattern = Address.fromLong((value & 0xFFL) * 0x0101010101010101L);
+        final Pointer wordEnd = end.roundedDownBy(Word.size());
+        while (p.lessThan(wordEnd)) {
+            p.writeWord(0, pattern);
+            p = p.plus(Word.size());
+        }
+        while (p.lessThan(end)) {
+            p.writeByte(0, value);
+            p = p.plus(1);
         }
     }
 
@@ -156,6 +266,10 @@ public final class Memory {
     @NO_SAFEPOINT_POLLS("speed, and used in code that shouldn't be interrupted by GC")
     public static void clearWords(Pointer start, int length) {
         FatalError.check(start.isWordAligned(), "Can only zero word-aligned region");
+        if (!isHosted() && length >= NATIVE_THRESHOLD / Word.size()) {
+            memory_set(start, Size.fromInt(length).times(Word.size()), 0);
+            return;
+        }
         for (int i = 0; i < length; i++) {
             start.setWord(i, Address.zero());
         }
@@ -163,9 +277,7 @@ public final class Memory {
 
     @NO_SAFEPOINT_POLLS("speed")
     public static void setBytes(Pointer pointer, int numberOfBytes, byte value) {
-        for (int i = 0; i < numberOfBytes; i++) {
-            pointer.writeByte(i, value);
-        }
+        setBytes(pointer, Size.fromInt(numberOfBytes), value);
     }
 
     @NO_SAFEPOINT_POLLS("speed")
@@ -175,10 +287,22 @@ public final class Memory {
 
     @NO_SAFEPOINT_POLLS("speed")
     public static boolean equals(Pointer pointer1, Pointer pointer2, Size numberOfBytes) {
-        for (Offset i = Offset.zero(); i.lessThan(numberOfBytes.asOffset()); i = i.plus(1)) {
+        if (!isHosted() && numberOfBytes.greaterEqual(NATIVE_THRESHOLD)) {
+            return memory_compare(pointer1, pointer2, numberOfBytes) == 0;
+        }
+        Offset i = Offset.zero();
+        final Size wordBounds = numberOfBytes.alignDown(Word.size());
+        while (i.lessThan(wordBounds.asOffset())) {
+            if (!pointer1.readWord(i).equals(pointer2.readWord(i))) {
+                return false;
+            }
+            i = i.plus(Word.size());
+        }
+        while (i.lessThan(numberOfBytes.asOffset())) {
             if (pointer1.readByte(i) != pointer2.readByte(i)) {
                 return false;
             }
+            i = i.plus(1);
         }
         return true;
     }
@@ -195,6 +319,10 @@ public final class Memory {
 
     @NO_SAFEPOINT_POLLS("speed")
     public static void copyBytes(Pointer fromPointer, Pointer toPointer, Size numberOfBytes) {
+        if (!isHosted() && numberOfBytes.greaterEqual(NATIVE_THRESHOLD)) {
+            memory_copy(fromPointer, toPointer, numberOfBytes);
+            return;
+        }
         Offset i = Offset.zero();
         Size wordBounds = numberOfBytes.alignDown(Word.size());
         while (i.lessThan(wordBounds.asOffset())) {
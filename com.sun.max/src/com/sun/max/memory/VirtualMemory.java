@@ -228,6 +228,8 @@ public final class VirtualMemory {
 
     /**
      * Return the amount of physical memory (in bytes) of the underlying platform.
+     * This ignores the memory limit of a container the VM runs in; see
+     * {@link com.sun.max.vm.runtime.OSResources#availableMemory()} for the amount available to the VM process.
      * @return amount of physical memory in bytes
      */
     @INLINE
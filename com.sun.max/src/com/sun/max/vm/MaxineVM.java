@@ -633,6 +633,15 @@ public final class MaxineVM {
     @C_FUNCTION
     public static native void core_dump();
 
+    /**
+     * Creates a stopped copy of the vm process that a debugger can attach to while the vm carries on. Only the
+     * calling thread exists in the copy.
+     *
+     * @return the process identifier of the copy, or -1 if it could not be created
+     */
+    @C_FUNCTION
+    public static native int fork_snapshot();
+
     @INSPECTED
     public final VMConfiguration config;
     public Phase phase = Phase.BOOTSTRAPPING;
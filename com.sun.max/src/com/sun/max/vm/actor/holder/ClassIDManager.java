@@ -27,6 +27,7 @@ import java.util.*;
 import com.sun.max.annotate.*;
 import com.sun.max.program.*;
 import com.sun.max.vm.*;
+import com.sun.max.vm.heap.*;
 import com.sun.max.vm.runtime.*;
 import com.sun.max.vm.type.*;
 
@@ -86,6 +87,7 @@ public final class ClassIDManager {
         final int id = usedIDs.nextClearBit(0);
         idToClassActor.set(id, null);
         usedIDs.set(id);
+        LiveClassHistogram.ensureCapacity(id);
         if (TraceClassIDs) {
             Log.println("Allocated class identifier " + id);
         }
@@ -446,6 +446,27 @@ public abstract class MethodActor extends MemberActor implements RiResolvedMetho
         return invocationStub;
     }
 
+    /**
+     * Gets the stub implementing {@link Method#invoke} or {@link Constructor#newInstance} for this method actor,
+     * creating it first if necessary. All the {@link Method} and {@link Constructor} objects reflecting this method,
+     * including the roots recreated after a class's reflection data has been reclaimed, share the stub instead of
+     * each generating and loading a new stub class.
+     */
+    public final InvocationStub makeReflectionStub() {
+        ClassRegistry classRegistry = holder().classRegistry();
+        InvocationStub reflectionStub = classRegistry.get(REFLECTION_STUB, this);
+
+        if (reflectionStub == null) {
+            if (isInstanceInitializer()) {
+                reflectionStub = InvocationStub.newConstructorStub(toJavaConstructor(), null, Boxing.JAVA);
+            } else {
+                reflectionStub = InvocationStub.newMethodStub(toJava(), Boxing.JAVA);
+            }
+            classRegistry.set(REFLECTION_STUB, this, reflectionStub);
+        }
+        return reflectionStub;
+    }
+
     public static boolean containWord(Value[] values) {
         for (Value value : values) {
             if (value.kind().isWord) {
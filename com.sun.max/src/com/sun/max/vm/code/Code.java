@@ -160,6 +160,25 @@ public final class Code {
         return new CodeMemoryManagerMXBean("Code");
     }
 
+    /**
+     * Incremented at the start and at the end of every code eviction. An odd value
+     * denotes an eviction in progress. Caches that map code pointers to target methods
+     * use this to detect that target methods may have moved or been discarded.
+     */
+    private static volatile int evictionEpoch;
+
+    /**
+     * Gets the current {@linkplain #evictionEpoch eviction epoch}.
+     */
+    @INLINE
+    public static int evictionEpoch() {
+        return evictionEpoch;
+    }
+
+    static void advanceEvictionEpoch() {
+        evictionEpoch++;
+    }
+
     public static CodeRegion bootCodeRegion() {
         return bootCodeRegion;
     }
@@ -562,6 +562,7 @@ public final class CodeEviction extends VmOperation {
         phase = Phase.PATCHING;
 
         CodeManager.Inspect.notifyEvictionStarted(CodeManager.runtimeBaselineCodeRegion);
+        Code.advanceEvictionEpoch();
 
         timerStart();
         doAllThreads();
@@ -610,6 +611,7 @@ public final class CodeEviction extends VmOperation {
             codeEvictionLogger.logMove_Progress("FINISHED walking threads");
         }
 
+        Code.advanceEvictionEpoch();
         CodeManager.Inspect.notifyEvictionCompleted(CodeManager.runtimeBaselineCodeRegion);
 
         // phase 3 (optional): dump after
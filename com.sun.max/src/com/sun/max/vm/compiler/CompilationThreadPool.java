@@ -44,18 +44,27 @@ public class CompilationThreadPool {
     private CompilationThread[] threadPool;
 
     /**
-     * Default size of compilation thread pool.  
+     * Default size of compilation thread pool, which is capped by the number of processors available to the VM.
      */
-    private static int CTPS = 4;
+    private static final int DEFAULT_CTPS = 4;
+
+    /**
+     * Size of the compilation thread pool, or 0 to use the default size.
+     */
+    private static int CTPS;
 
     private static boolean GCOnRecompilation;
 
     static {
         addFieldOption("-XX:", "GCOnRecompilation", CompilationThreadPool.class, "Force GC before every re-compilation.");
-        addFieldOption("-XX:", "CTPS", CompilationThreadPool.class, "Compilation threadpool size (Default: 4)");
+        addFieldOption("-XX:", "CTPS", CompilationThreadPool.class, "Compilation threadpool size (Default: 4, or the number of available processors if less)");
     }
 
     public CompilationThreadPool() {
+        if (CTPS <= 0) {
+            // Do not oversubscribe the processors granted to the VM, e.g. by the CPU quota of a container
+            CTPS = Math.min(DEFAULT_CTPS, Runtime.getRuntime().availableProcessors());
+        }
         threadPool = new CompilationThread[CTPS];
         for (int i = 0; i < CTPS; i++) {
             threadPool[i] = new CompilationThread();
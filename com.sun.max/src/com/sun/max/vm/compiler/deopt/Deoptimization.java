@@ -162,6 +162,87 @@ public class Deoptimization extends VmOperation {
         submit();
     }
 
+    /**
+     * Guards {@link #pendingBatch}, {@link #batchesRequested}, {@link #batchesCompleted} and {@link #batchInProgress}.
+     */
+    private static final Object batchLock = new Object();
+
+    /**
+     * Methods from {@linkplain #deoptimizeBatched(ArrayList) batched requests} not yet handed to a VM operation.
+     */
+    private static final ArrayList<TargetMethod> pendingBatch = new ArrayList<TargetMethod>();
+
+    private static long batchesRequested;
+    private static long batchesCompleted;
+    private static boolean batchInProgress;
+
+    /**
+     * Deoptimizes a set of methods, sharing a single VM operation with any concurrent callers of this method.
+     * This is used when a burst of class definitions on several threads invalidates dependencies: instead of
+     * one stop-the-world operation per class, all requests made while an operation is in progress are
+     * served by the next one. The call returns once a VM operation covering {@code methods} has completed.
+     * If the operation fails, its methods are requeued for the next operation and the failure is propagated
+     * to the caller that ran it; the other callers retry.
+     *
+     * @param methods the set of methods to be deoptimized
+     */
+    public static void deoptimizeBatched(ArrayList<TargetMethod> methods) {
+        final long ticket;
+        synchronized (batchLock) {
+            for (TargetMethod tm : methods) {
+                if (!pendingBatch.contains(tm)) {
+                    pendingBatch.add(tm);
+                }
+            }
+            ticket = ++batchesRequested;
+        }
+        boolean interrupted = false;
+        while (true) {
+            final ArrayList<TargetMethod> batch;
+            final long batchTicket;
+            synchronized (batchLock) {
+                if (batchesCompleted >= ticket) {
+                    break;
+                }
+                if (batchInProgress) {
+                    try {
+                        batchLock.wait();
+                    } catch (InterruptedException e) {
+                        interrupted = true;
+                    }
+                    continue;
+                }
+                batch = new ArrayList<TargetMethod>(pendingBatch);
+                pendingBatch.clear();
+                batchTicket = batchesRequested;
+                batchInProgress = true;
+            }
+            boolean deoptimized = false;
+            try {
+                new Deoptimization(batch).go();
+                deoptimized = true;
+            } finally {
+                synchronized (batchLock) {
+                    batchInProgress = false;
+                    if (deoptimized) {
+                        batchesCompleted = batchTicket;
+                    } else {
+                        // The waiters for this batch must not return: hand its methods to the next operation
+                        for (TargetMethod tm : batch) {
+                            if (!pendingBatch.contains(tm)) {
+                                pendingBatch.add(tm);
+                            }
+                        }
+                    }
+                    batchLock.notifyAll();
+                }
+            }
+        }
+        if (interrupted) {
+            Thread.currentThread().interrupt();
+        }
+    }
+
     @Override
     protected void doIt() {
         Stub staticTrampoline = vm().stubs.staticTrampoline();
@@ -35,7 +35,6 @@ import com.sun.cri.ri.*;
 import com.sun.max.vm.*;
 import com.sun.max.vm.actor.holder.*;
 import com.sun.max.vm.actor.member.*;
-import com.sun.max.vm.compiler.deopt.*;
 import com.sun.max.vm.compiler.deps.ContextDependents.*;
 import com.sun.max.vm.compiler.deps.Dependencies.*;
 import com.sun.max.vm.compiler.target.*;
@@ -262,14 +261,15 @@ public class ConcreteTypeDependencyProcessor extends DependencyProcessor {
     }
 
     /**
-     * Processes a list of invalidated dependencies, triggering deopt as necessary.
+     * Processes a list of invalidated dependencies, collecting the target methods that need to be deoptimized.
      *
      * @param invalidated the head of a {@link Dependencies} list (which may contain duplicates)
      * @param classActor the class to be added to the global class hierarchy
+     * @return the methods to deoptimize or {@code null} if there are none
      */
-    static void invalidateDependencies(ArrayList<Dependencies> invalidated, ClassActor classActor) {
+    static ArrayList<TargetMethod> invalidateDependencies(ArrayList<Dependencies> invalidated, ClassActor classActor) {
         if (invalidated == null) {
-            return;
+            return null;
         }
         if (dependenciesLogger.enabled()) {
             dependenciesLogger.logInvalidateDeps(classActor);
@@ -287,11 +287,10 @@ public class ConcreteTypeDependencyProcessor extends DependencyProcessor {
                 methods.add(deps.targetMethod);
             }
         }
-        if (MaxineVM.isHosted()) {
-            return;
-        } else if (!methods.isEmpty()) {
-            new Deoptimization(methods).go();
+        if (MaxineVM.isHosted() || methods.isEmpty()) {
+            return null;
         }
+        return methods;
     }
 
 
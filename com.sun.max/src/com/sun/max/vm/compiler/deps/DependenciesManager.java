@@ -30,6 +30,7 @@ import com.sun.max.program.*;
 import com.sun.max.vm.*;
 import com.sun.max.vm.actor.holder.*;
 import com.sun.max.vm.actor.member.*;
+import com.sun.max.vm.compiler.deopt.*;
 import com.sun.max.vm.compiler.target.*;
 import com.sun.max.vm.hosted.*;
 import com.sun.max.vm.log.VMLog.*;
@@ -139,14 +140,23 @@ public final class DependenciesManager {
      */
     public static void addToHierarchy(ClassActor classActor) {
         boolean refreshTables = false;
-        classHierarchyLock.writeLock().lock();
+        ArrayList<TargetMethod> deoptMethods = null;
         try {
-            classActor.prependToSiblingList();
-            ArrayList<Dependencies> invalidated = ConcreteTypeDependencyProcessor.recordUniqueConcreteSubtype(classActor);
-            ConcreteTypeDependencyProcessor.invalidateDependencies(invalidated, classActor);
-            refreshTables = true;
+            classHierarchyLock.writeLock().lock();
+            try {
+                classActor.prependToSiblingList();
+                ArrayList<Dependencies> invalidated = ConcreteTypeDependencyProcessor.recordUniqueConcreteSubtype(classActor);
+                deoptMethods = ConcreteTypeDependencyProcessor.invalidateDependencies(invalidated, classActor);
+                refreshTables = true;
+            } finally {
+                classHierarchyLock.writeLock().unlock();
+            }
+            if (deoptMethods != null) {
+                // The dependencies are already invalidated. Deoptimizing outside of the lock lets
+                // concurrent class definitions share a single VM operation.
+                Deoptimization.deoptimizeBatched(deoptMethods);
+            }
         } finally {
-            classHierarchyLock.writeLock().unlock();
             if (!MaxineVM.isHosted() && refreshTables) {
                 // Don't need to be under the class hierarchy lock to do this.
                 classActor.dynamicHub().refreshVTable();
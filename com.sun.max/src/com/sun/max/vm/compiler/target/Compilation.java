@@ -31,6 +31,7 @@ import com.sun.max.vm.actor.member.*;
 import com.sun.max.vm.compiler.*;
 import com.sun.max.vm.compiler.RuntimeCompiler.Nature;
 import com.sun.max.vm.heap.*;
+import com.sun.max.vm.management.*;
 import com.sun.max.vm.runtime.*;
 import com.sun.max.vm.stack.*;
 import com.sun.max.vm.tele.*;
@@ -101,6 +102,13 @@ public class Compilation {
     @RESET
     private static long compilationAllocation;
 
+    private static final PerfLong totalCompiles = PerfMemory.createLong("sun.ci.totalCompiles",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_EVENTS);
+    private static final PerfLong totalBailouts = PerfMemory.createLong("sun.ci.totalBailouts",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_EVENTS);
+    private static final PerfLong totalCompileTime = PerfMemory.createLong("java.ci.totalTime",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_TICKS);
+
     public RuntimeCompiler compiler;
     public final ClassMethodActor classMethodActor;
     public final Compilation parent;
@@ -292,10 +300,13 @@ public class Compilation {
 
             startCompilationMetricsCollection();
 
+            final long startTime = PerfMemory.ticks();
             result = compiler.compile(classMethodActor, isDeopt, true, null);
             if (result == null) {
                 throw new InternalError(classMethodActor.format("Result of compiling of %H.%n(%p) is null"));
             }
+            totalCompileTime.add(PerfMemory.ticks() - startTime);
+            totalCompiles.increment();
 
             InspectableCompilationInfo.notifyCompilationEvent(result.classMethodActor, result);
 
@@ -334,6 +345,7 @@ public class Compilation {
         }
         if (error != null) {
             // an error occurred
+            totalBailouts.increment();
             logCompilationError(error);
         } else if (result == null) {
             // the compilation didn't produce a target method
@@ -104,7 +104,15 @@ public final class Heap {
 
     public static boolean OptimizeJNICritical = true;
 
+    /**
+     * Percentage of the memory limit of the container the VM runs in that the default maximum heap size may use,
+     * between 1 and 100.
+     */
+    public static int MaxRAMPercentage = 25;
+
     static {
+        VMOptions.addFieldOption("-XX:", "MaxRAMPercentage", Heap.class,
+            "Percentage (1 to 100) of the memory limit of a container that the default maximum heap size may use.", MaxineVM.Phase.PRISTINE);
         VMOptions.addFieldOption("-XX:", "OptimizeJNICritical", Heap.class, "Use GC disabling to optimize JNI 'critical' functions when heap scheme doesn't support object pinning.", MaxineVM.Phase.PRISTINE);
         VMOptions.addFieldOption("-XX:", "AvoidsAnonOperations", Heap.class, "Avoids using Anonymous Memory operations as much as possible.", MaxineVM.Phase.PRISTINE);
     }
@@ -182,6 +190,9 @@ public final class Heap {
         if (heapSizingInputValidated) {
             return null;
         }
+        if (MaxRAMPercentage < 1 || MaxRAMPercentage > 100) {
+            return "MaxRAMPercentage must be between 1 and 100";
+        }
         Size max = heapSizeInfo.getMaxSize();
         Size init = heapSizeInfo.getInitialSize();
         if (maxHeapSizeOption.isPresent()) {
@@ -203,6 +214,17 @@ public final class Heap {
                 return "Heap too small";
             }
             max = init;
+        } else {
+            Size limit = OSResources.memoryLimit();
+            if (!limit.isZero()) {
+                // Size the default heap for the container rather than for the whole host
+                Size containerMax = limit.dividedBy(100).times(MaxRAMPercentage).alignDown(Size.M.toInt());
+                if (containerMax.lessThan(MIN_HEAP_SIZE)) {
+                    containerMax = MIN_HEAP_SIZE;
+                }
+                max = Size.min(max, containerMax);
+                init = Size.min(init, max);
+            }
         }
 
         maxSize = max;
@@ -328,6 +350,16 @@ public final class Heap {
         return array;
     }
 
+    /**
+     * Allocates all the arrays of a multi-dimensional array at once if the heap scheme supports it.
+     *
+     * @see HeapScheme#createMultiArray(DynamicHub, int[])
+     * @return the outermost array, or {@code null} if the arrays must be allocated one at a time
+     */
+    public static Object createMultiArray(DynamicHub hub, int[] lengths) {
+        return heapScheme().createMultiArray(hub, lengths);
+    }
+
     @NEVER_INLINE
     private static void doDebugAfterCreateTuple(Hub hub, Object object) {
         allocationLogger.logUnalignedTuple(object, hub.classActor);
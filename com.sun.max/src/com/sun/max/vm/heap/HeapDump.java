@@ -0,0 +1,590 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package com.sun.max.vm.heap;
+
+import static com.sun.max.vm.VMConfiguration.*;
+
+import java.io.*;
+
+import com.sun.max.unsafe.*;
+import com.sun.max.vm.*;
+import com.sun.max.vm.actor.holder.*;
+import com.sun.max.vm.actor.member.*;
+import com.sun.max.vm.classfile.constant.*;
+import com.sun.max.vm.layout.*;
+import com.sun.max.vm.object.*;
+import com.sun.max.vm.reference.*;
+import com.sun.max.vm.runtime.*;
+import com.sun.max.vm.type.*;
+
+/**
+ * Writes a snapshot of the heap in the HPROF binary format (version 1.0.2) understood by heap analysis tools.
+ * <p>
+ * The heap is walked at a safepoint with {@link HeapScheme#walkHeap(CallbackCellVisitor)}. Records are streamed
+ * through a single buffer whose contents form one {@code HEAP_DUMP_SEGMENT} each time it is flushed, so writing
+ * a dump needs no memory proportional to the size of the heap.
+ * <p>
+ * Identifiers are addresses: an object is identified by its origin and a class by the origin of its
+ * {@link Class} mirror, so that tools can match a class with the instance record of its mirror. Arrays
+ * too large for the 32-bit length of a record are truncated, as HotSpot does. All classes are reported as sticky roots and all {@link Thread} objects as roots of unknown
+ * type. References from thread stacks are not reported.
+ */
+public final class HeapDump {
+
+    private HeapDump() {
+    }
+
+    private static final int BUFFER_SIZE = 4 * 1024 * 1024;
+
+    // Top level record tags
+    private static final int HPROF_UTF8 = 0x01;
+    private static final int HPROF_LOAD_CLASS = 0x02;
+    private static final int HPROF_TRACE = 0x05;
+    private static final int HPROF_HEAP_DUMP_SEGMENT = 0x1C;
+    private static final int HPROF_HEAP_DUMP_END = 0x2C;
+
+    // Heap dump sub-record tags
+    private static final int HPROF_GC_ROOT_UNKNOWN = 0xFF;
+    private static final int HPROF_GC_ROOT_STICKY_CLASS = 0x05;
+    private static final int HPROF_GC_CLASS_DUMP = 0x20;
+    private static final int HPROF_GC_INSTANCE_DUMP = 0x21;
+    private static final int HPROF_GC_OBJ_ARRAY_DUMP = 0x22;
+    private static final int HPROF_GC_PRIM_ARRAY_DUMP = 0x23;
+
+    // Basic types
+    private static final int HPROF_NORMAL_OBJECT = 2;
+    private static final int HPROF_BOOLEAN = 4;
+    private static final int HPROF_CHAR = 5;
+    private static final int HPROF_FLOAT = 6;
+    private static final int HPROF_DOUBLE = 7;
+    private static final int HPROF_BYTE = 8;
+    private static final int HPROF_SHORT = 9;
+    private static final int HPROF_INT = 10;
+    private static final int HPROF_LONG = 11;
+
+    /**
+     * Serial number of the single, empty stack trace that all objects refer to.
+     */
+    private static final int STACK_TRACE_SERIAL = 1;
+
+    private static final int RECORD_HEADER_SIZE = 9;
+
+    /**
+     * The largest length of a record, which is an unsigned 32-bit value.
+     */
+    private static final long MAX_RECORD_LENGTH = 0xFFFFFFFFL;
+
+    /**
+     * Writes an HPROF dump of the heap to a file.
+     *
+     * @param path the file to write
+     * @param live if {@code true}, a garbage collection is performed first so that only live objects are dumped
+     * @return 0 on success
+     * @throws IOException if the file could not be written
+     */
+    public static int dump(String path, boolean live) throws IOException {
+        if (live) {
+            Heap.collectGarbage();
+        }
+        final FileOutputStream out = new FileOutputStream(path);
+        try {
+            // Read outside the safepoint as the class ID manager is guarded by a lock that a stopped thread may hold
+            final int largestClassId = ClassIDManager.largestClassId();
+            // Mirrors identify classes in the dump: create the missing ones now rather than during the heap walk
+            for (int id = 0; id <= largestClassId; id++) {
+                final ClassActor classActor = ClassIDManager.toClassActor(id);
+                if (classActor != null) {
+                    classActor.javaClass();
+                }
+            }
+            final DumpOperation operation = new DumpOperation(out, largestClassId);
+            operation.submit();
+            if (operation.error != null) {
+                throw operation.error;
+            }
+        } finally {
+            out.close();
+        }
+        return 0;
+    }
+
+    static final class DumpOperation extends VmOperation {
+
+        private final OutputStream out;
+        private final int largestClassId;
+        private final int idSize = Word.size();
+        private final byte[] buffer = new byte[BUFFER_SIZE];
+        private int position;
+
+        /**
+         * Index in {@link #buffer} of the header of the open heap dump segment or -1 if no segment is open.
+         */
+        private int segmentStart = -1;
+
+        IOException error;
+
+        private final CallbackCellVisitor visitor = new CallbackCellVisitor() {
+            @Override
+            protected boolean callback(Object object) {
+                try {
+                    writeObject(object);
+                    return true;
+                } catch (IOException e) {
+                    error = e;
+                    return false;
+                }
+            }
+        };
+
+        DumpOperation(OutputStream out, int largestClassId) {
+            super("HeapDump", null, Mode.Safepoint);
+            this.out = out;
+            this.largestClassId = largestClassId;
+        }
+
+        @Override
+        protected void doIt() {
+            // Any allocation (e.g. of an exception) must not disturb the heap being walked
+            try {
+                Heap.enableImmortalMemoryAllocation();
+                writeHeader();
+                for (int id = 0; id <= largestClassId; id++) {
+                    final ClassActor classActor = ClassIDManager.toClassActor(id);
+                    if (classActor != null) {
+                        writeLoadClass(id, classActor);
+                    }
+                }
+                writeRecordHeader(HPROF_TRACE, 12);
+                u4(STACK_TRACE_SERIAL);
+                u4(0);
+                u4(0);
+                for (int id = 0; id <= largestClassId; id++) {
+                    final ClassActor classActor = ClassIDManager.toClassActor(id);
+                    if (classActor != null) {
+                        writeClassDump(classActor);
+                    }
+                }
+                vmConfig().heapScheme().walkHeap(visitor);
+                if (error == null) {
+                    endSegment();
+                    writeRecordHeader(HPROF_HEAP_DUMP_END, 0);
+                    flush();
+                }
+            } catch (IOException e) {
+                error = e;
+            } finally {
+                Heap.disableImmortalMemoryAllocation();
+            }
+        }
+
+        private void writeHeader() throws IOException {
+            final String format = "JAVA PROFILE 1.0.2";
+            ensure(format.length() + 1 + 4 + 8);
+            for (int i = 0; i < format.length(); i++) {
+                buffer[position++] = (byte) format.charAt(i);
+            }
+            buffer[position++] = 0;
+            u4(idSize);
+            u8(System.currentTimeMillis());
+        }
+
+        private void writeLoadClass(int id, ClassActor classActor) throws IOException {
+            // Class names use the internal form, e.g. "java/lang/String" and "[I"
+            final String name = classActor.isArrayClass() ? classActor.typeDescriptor.string : classActor.name.string;
+            writeUtf8(classActor.typeDescriptor, name, true);
+            writeRecordHeader(HPROF_LOAD_CLASS, 4 + idSize + 4 + idSize);
+            u4(id + 1);
+            classId(classActor);
+            u4(STACK_TRACE_SERIAL);
+            id(classActor.typeDescriptor);
+
+            for (FieldActor fieldActor : classActor.localStaticFieldActors()) {
+                writeUtf8(fieldActor.name, fieldActor.name.string, false);
+            }
+            for (FieldActor fieldActor : classActor.localInstanceFieldActors()) {
+                writeUtf8(fieldActor.name, fieldActor.name.string, false);
+            }
+        }
+
+        /**
+         * Writes a UTF8 record for a string that is identified by the address of {@code key}.
+         * The string is encoded without allocation; characters outside of ASCII are replaced by {@code '?'}.
+         */
+        private void writeUtf8(Object key, String string, boolean slashify) throws IOException {
+            final int length = string.length();
+            writeRecordHeader(HPROF_UTF8, idSize + length);
+            id(key);
+            for (int i = 0; i < length; i++) {
+                ensure(1);
+                char c = string.charAt(i);
+                if (slashify && c == '.') {
+                    c = '/';
+                }
+                buffer[position++] = c < 0x80 ? (byte) c : (byte) '?';
+            }
+        }
+
+        private void writeClassDump(ClassActor classActor) throws IOException {
+            final FieldActor[] staticFieldActors = classActor.localStaticFieldActors();
+            final FieldActor[] instanceFieldActors = classActor.localInstanceFieldActors();
+            long size = 1 + 7 * idSize + 4 + 4 + 2 + 2 + 2 + instanceFieldActors.length * (idSize + 1);
+            for (FieldActor fieldActor : staticFieldActors) {
+                size += idSize + 1 + valueSize(fieldActor.kind);
+            }
+            beginSubrecord(size + 1 + idSize);
+
+            u1(HPROF_GC_ROOT_STICKY_CLASS);
+            classId(classActor);
+
+            u1(HPROF_GC_CLASS_DUMP);
+            classId(classActor);
+            u4(STACK_TRACE_SERIAL);
+            classId(classActor.superClassActor);
+            id(classActor.classLoader);
+            id(null); // signers
+            id(null); // protection domain
+            id(null); // reserved
+            id(null); // reserved
+            u4(classActor.isArrayClass() || classActor.dynamicHub() == null ? 0 : classActor.dynamicTupleSize().toInt());
+            u2(0); // constant pool
+
+            final Object staticTuple = classActor.staticTuple();
+            u2(staticFieldActors.length);
+            for (FieldActor fieldActor : staticFieldActors) {
+                id(fieldActor.name);
+                u1(basicType(fieldActor.kind));
+                if (staticTuple == null) {
+                    for (int i = valueSize(fieldActor.kind); i > 0; i--) {
+                        u1(0);
+                    }
+                } else {
+                    writeValue(Reference.fromJava(staticTuple), fieldActor);
+                }
+            }
+
+            u2(instanceFieldActors.length);
+            for (FieldActor fieldActor : instanceFieldActors) {
+                id(fieldActor.name);
+                u1(basicType(fieldActor.kind));
+            }
+        }
+
+        private void writeObject(Object object) throws IOException {
+            final Reference reference = Reference.fromJava(object);
+            final ClassActor classActor = ObjectAccess.readClassActor(object);
+            if (classActor.isArrayClass()) {
+                final Kind componentKind = classActor.componentClassActor().kind;
+                if (componentKind.isReference) {
+                    final int headerSize = 1 + idSize + 4 + 4 + idSize;
+                    final int length = dumpedArrayLength(reference, headerSize, idSize);
+                    beginSubrecord(headerSize + (long) length * idSize);
+                    u1(HPROF_GC_OBJ_ARRAY_DUMP);
+                    id(reference);
+                    u4(STACK_TRACE_SERIAL);
+                    u4(length);
+                    classId(classActor);
+                    for (int i = 0; i < length; i++) {
+                        id(Layout.getReference(reference, i));
+                    }
+                } else {
+                    final int headerSize = 1 + idSize + 4 + 4 + 1;
+                    final int length = dumpedArrayLength(reference, headerSize, valueSize(componentKind));
+                    beginSubrecord(headerSize + (long) length * valueSize(componentKind));
+                    u1(HPROF_GC_PRIM_ARRAY_DUMP);
+                    id(reference);
+                    u4(STACK_TRACE_SERIAL);
+                    u4(length);
+                    u1(basicType(componentKind));
+                    writeElements(reference, componentKind, length);
+                }
+                return;
+            }
+
+            // Hybrid objects (e.g. hubs) are dumped without their array part
+            long valuesSize = 0;
+            for (ClassActor c = classActor; c != null; c = c.superClassActor) {
+                for (FieldActor fieldActor : c.localInstanceFieldActors()) {
+                    valuesSize += valueSize(fieldActor.kind);
+                }
+            }
+            final boolean isThread = object instanceof Thread;
+            beginSubrecord(1 + idSize + 4 + idSize + 4 + valuesSize + (isThread ? 1 + idSize : 0));
+            u1(HPROF_GC_INSTANCE_DUMP);
+            id(reference);
+            u4(STACK_TRACE_SERIAL);
+            classId(classActor);
+            u4(recordLength(valuesSize));
+            for (ClassActor c = classActor; c != null; c = c.superClassActor) {
+                for (FieldActor fieldActor : c.localInstanceFieldActors()) {
+                    writeValue(reference, fieldActor);
+                }
+            }
+            if (isThread) {
+                u1(HPROF_GC_ROOT_UNKNOWN);
+                id(reference);
+            }
+        }
+
+        private void writeValue(Reference reference, FieldActor fieldActor) throws IOException {
+            final int offset = fieldActor.offset();
+            switch (fieldActor.kind.asEnum) {
+                case BOOLEAN:
+                case BYTE:
+                    u1(reference.readByte(offset));
+                    break;
+                case SHORT:
+                case CHAR:
+                    u2(reference.readChar(offset));
+                    break;
+                case INT:
+                case FLOAT:
+                    u4(reference.readInt(offset));
+                    break;
+                case LONG:
+                case DOUBLE:
+                    u8(reference.readLong(offset));
+                    break;
+                case WORD:
+                    word(reference.readWord(offset));
+                    break;
+                case REFERENCE:
+                    id(reference.readReference(offset));
+                    break;
+                default:
+                    throw FatalError.unexpected("unexpected field kind: " + fieldActor.kind);
+            }
+        }
+
+        private void writeElements(Reference array, Kind kind, int length) throws IOException {
+            switch (kind.asEnum) {
+                case BOOLEAN:
+                case BYTE:
+                    for (int i = 0; i < length; i++) {
+                        u1(Layout.getByte(array, i));
+                    }
+                    break;
+                case SHORT:
+                case CHAR:
+                    for (int i = 0; i < length; i++) {
+                        u2(Layout.getChar(array, i));
+                    }
+                    break;
+                case INT:
+                    for (int i = 0; i < length; i++) {
+                        u4(Layout.getInt(array, i));
+                    }
+                    break;
+                case FLOAT:
+                    for (int i = 0; i < length; i++) {
+                        u4(Float.floatToRawIntBits(Layout.getFloat(array, i)));
+                    }
+                    break;
+                case LONG:
+                    for (int i = 0; i < length; i++) {
+                        u8(Layout.getLong(array, i));
+                    }
+                    break;
+                case DOUBLE:
+                    for (int i = 0; i < length; i++) {
+                        u8(Double.doubleToRawLongBits(Layout.getDouble(array, i)));
+                    }
+                    break;
+                case WORD:
+                    for (int i = 0; i < length; i++) {
+                        word(Layout.getWord(array, i));
+                    }
+                    break;
+                default:
+                    throw FatalError.unexpected("unexpected array element kind: " + kind);
+            }
+        }
+
+        private int basicType(Kind kind) {
+            switch (kind.asEnum) {
+                case BOOLEAN: return HPROF_BOOLEAN;
+                case BYTE:    return HPROF_BYTE;
+                case SHORT:   return HPROF_SHORT;
+                case CHAR:    return HPROF_CHAR;
+                case INT:     return HPROF_INT;
+                case FLOAT:   return HPROF_FLOAT;
+                case LONG:    return HPROF_LONG;
+                case DOUBLE:  return HPROF_DOUBLE;
+                case WORD:    return idSize == 8 ? HPROF_LONG : HPROF_INT;
+                default:      return HPROF_NORMAL_OBJECT;
+            }
+        }
+
+        private int valueSize(Kind kind) {
+            switch (kind.asEnum) {
+                case BOOLEAN:
+                case BYTE:
+                    return 1;
+                case SHORT:
+                case CHAR:
+                    return 2;
+                case INT:
+                case FLOAT:
+                    return 4;
+                case LONG:
+                case DOUBLE:
+                    return 8;
+                default:
+                    return idSize;
+            }
+        }
+
+        /**
+         * Gets the number of elements of an array that are dumped: an array whose record would exceed
+         * {@link #MAX_RECORD_LENGTH} is truncated to the longest prefix that fits.
+         */
+        private int dumpedArrayLength(Reference array, int headerSize, int elementSize) {
+            final int length = Layout.readArrayLength(array);
+            final long maxLength = (MAX_RECORD_LENGTH - headerSize) / elementSize;
+            if (length > maxLength) {
+                Log.print("Warning: heap dump truncates array at ");
+                Log.print(array.toOrigin());
+                Log.print(" from ");
+                Log.print(length);
+                Log.print(" to ");
+                Log.print(maxLength);
+                Log.println(" elements");
+                return (int) maxLength;
+            }
+            return length;
+        }
+
+        /**
+         * Converts the length of a record to its unsigned 32-bit encoding.
+         */
+        private int recordLength(long length) {
+            FatalError.check(length >= 0 && length <= MAX_RECORD_LENGTH, "heap dump record too large");
+            return (int) length;
+        }
+
+        private void writeRecordHeader(int tag, int length) throws IOException {
+            endSegment();
+            ensure(RECORD_HEADER_SIZE);
+            u1(tag);
+            u4(0);
+            u4(length);
+        }
+
+        /**
+         * Makes room for a heap dump sub-record of a given size. Sub-records that fit are gathered in the
+         * segment filling the buffer. A sub-record larger than the buffer gets a segment of its own, which
+         * is streamed out as it is written.
+         */
+        private void beginSubrecord(long size) throws IOException {
+            if (segmentStart >= 0 && position + size <= buffer.length) {
+                return;
+            }
+            endSegment();
+            if (RECORD_HEADER_SIZE + size <= buffer.length) {
+                ensure(RECORD_HEADER_SIZE);
+                segmentStart = position;
+                u1(HPROF_HEAP_DUMP_SEGMENT);
+                u4(0);
+                u4(0); // patched by endSegment()
+            } else {
+                ensure(RECORD_HEADER_SIZE);
+                u1(HPROF_HEAP_DUMP_SEGMENT);
+                u4(0);
+                u4(recordLength(size));
+            }
+        }
+
+        private void endSegment() throws IOException {
+            if (segmentStart >= 0) {
+                final int length = position - (segmentStart + RECORD_HEADER_SIZE);
+                final int lengthIndex = segmentStart + 5;
+                buffer[lengthIndex] = (byte) (length >>> 24);
+                buffer[lengthIndex + 1] = (byte) (length >>> 16);
+                buffer[lengthIndex + 2] = (byte) (length >>> 8);
+                buffer[lengthIndex + 3] = (byte) length;
+                segmentStart = -1;
+                flush();
+            }
+        }
+
+        private void ensure(int n) throws IOException {
+            if (position + n > buffer.length) {
+                FatalError.check(segmentStart < 0, "heap dump segment overflow");
+                flush();
+            }
+        }
+
+        private void flush() throws IOException {
+            out.write(buffer, 0, position);
+            position = 0;
+        }
+
+        private void u1(int value) throws IOException {
+            ensure(1);
+            buffer[position++] = (byte) value;
+        }
+
+        private void u2(int value) throws IOException {
+            ensure(2);
+            buffer[position++] = (byte) (value >>> 8);
+            buffer[position++] = (byte) value;
+        }
+
+        private void u4(int value) throws IOException {
+            ensure(4);
+            buffer[position++] = (byte) (value >>> 24);
+            buffer[position++] = (byte) (value >>> 16);
+            buffer[position++] = (byte) (value >>> 8);
+            buffer[position++] = (byte) value;
+        }
+
+        private void u8(long value) throws IOException {
+            u4((int) (value >>> 32));
+            u4((int) value);
+        }
+
+        private void word(Word value) throws IOException {
+            if (idSize == 8) {
+                u8(value.asAddress().toLong());
+            } else {
+                u4(value.asAddress().toInt());
+            }
+        }
+
+        private void id(Reference reference) throws IOException {
+            word(reference.toOrigin());
+        }
+
+        private void id(Object object) throws IOException {
+            if (object == null) {
+                word(Address.zero());
+            } else {
+                id(Reference.fromJava(object));
+            }
+        }
+
+        /**
+         * Writes the identifier of a class, the origin of its mirror. The mirrors were created before the safepoint
+         * except for classes defined since, whose mirrors are created in immortal memory.
+         */
+        private void classId(ClassActor classActor) throws IOException {
+            id(classActor == null ? null : classActor.javaClass());
+        }
+    }
+}
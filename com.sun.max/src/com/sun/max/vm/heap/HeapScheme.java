@@ -183,6 +183,15 @@ public interface HeapScheme extends VMScheme {
      */
     Object createArray(DynamicHub hub, int length);
 
+    /**
+     * Allocate all the arrays of a multi-dimensional array at once, if the heap scheme can do so cheaply.
+     *
+     * @param hub the hub of the outermost array
+     * @param lengths the non-negative lengths of the dimensions to allocate, outermost first
+     * @return the outermost array, or {@code null} if the caller must allocate the arrays one at a time
+     */
+    Object createMultiArray(DynamicHub hub, int[] lengths);
+
     /**
      * Allocate a new tuple and fill in its header and initial data. Obtain the cell size from the given tuple class
      * actor.
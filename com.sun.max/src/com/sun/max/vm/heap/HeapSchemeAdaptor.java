@@ -271,6 +271,10 @@ public abstract class HeapSchemeAdaptor extends AbstractVMScheme implements Heap
         return false;
     }
 
+    public Object createMultiArray(DynamicHub hub, int[] lengths) {
+        return null;
+    }
+
     @INLINE
     public int objectAlignment() {
         return Platform.target().arch.isARM() ? 2 * Word.size() : Word.size();
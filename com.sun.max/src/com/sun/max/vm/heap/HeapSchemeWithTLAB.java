@@ -39,6 +39,7 @@ import com.sun.max.vm.intrinsics.*;
 import com.sun.max.vm.layout.*;
 import com.sun.max.vm.log.VMLog.Record;
 import com.sun.max.vm.log.hosted.*;
+import com.sun.max.vm.management.*;
 import com.sun.max.vm.object.*;
 import com.sun.max.vm.profilers.tracing.numa.NUMAProfiler;
 import com.sun.max.vm.reference.*;
@@ -108,6 +109,28 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
     private static final VMSizeOption tlabSizeOption = register(new VMSizeOption("-XX:TLABSize=", Size.K.times(64),
         "The size of thread-local allocation buffers."), MaxineVM.Phase.PRISTINE);
 
+    /**
+     * A VM option for disabling per-thread adaptive sizing of TLABs.
+     */
+    public static boolean ResizeTLAB = true;
+
+    /**
+     * Number of TLAB refills a thread should need between two GCs when TLABs are resized.
+     */
+    public static int TLABRefillTarget = 50;
+    static {
+        VMOptions.addFieldOption("-XX:", "ResizeTLAB", HeapSchemeWithTLAB.class,
+            "Resize each thread's TLAB based on the thread's allocation between GCs.", MaxineVM.Phase.PRISTINE);
+        VMOptions.addFieldOption("-XX:", "TLABRefillTarget", HeapSchemeWithTLAB.class,
+            "Number of TLAB refills a thread should need between two GCs when TLABs are resized.", MaxineVM.Phase.PRISTINE);
+    }
+
+    private static final VMSizeOption minTlabSizeOption = register(new VMSizeOption("-XX:MinTLABSize=", Size.K.times(2),
+        "The smallest size a resized thread-local allocation buffer may have."), MaxineVM.Phase.PRISTINE);
+
+    private static final VMSizeOption maxTlabSizeOption = register(new VMSizeOption("-XX:MaxTLABSize=", Size.K.times(256),
+        "The largest size a resized thread-local allocation buffer may have."), MaxineVM.Phase.PRISTINE);
+
     /**
      * The top of the current thread-local allocation buffer. This will remain zero if TLABs are not
      * {@linkplain #useTLAB enabled}.
@@ -164,6 +187,7 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
             if (logTLAB()) {
                 logger.logReset(UnsafeCast.asVmThread(VM_THREAD.loadRef(etla).toJava()), tlabTop, tlabMark);
             }
+            final TLABRefillPolicy refillPolicy = TLABRefillPolicy.getForCurrentThread(etla);
             if (tlabTop.equals(Address.zero())) {
                 // TLAB's top can be null in only two cases:
                 // (1) it has never been filled, in which case it's allocation mark is null too
@@ -173,7 +197,6 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
                 }
                 // (2) allocation has been disabled for the thread.
                 FatalError.check(!ALLOCATION_DISABLED.load(currentTLA()).isZero(), "inconsistent TLAB state");
-                TLABRefillPolicy refillPolicy = TLABRefillPolicy.getForCurrentThread(etla);
                 if (refillPolicy != null) {
                     // Go fetch the actual TLAB top in case the heap scheme needs it for its doBeforeReset handler.
                     tlabTop = refillPolicy.getSavedTlabTop().asPointer();
@@ -184,6 +207,12 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
             doBeforeReset(etla, tlabMark, tlabTop);
             TLAB_TOP.store(etla, Address.zero());
             TLAB_MARK.store(etla, Address.zero());
+            if (refillPolicy != null) {
+                refillPolicy.notifyReset(tlabTop.minus(tlabMark).asSize());
+                if (PrintTLABStats) {
+                    refillPolicy.printStats(UnsafeCast.asVmThread(VM_THREAD.loadRef(etla).toJava()));
+                }
+            }
         }
     }
 
@@ -219,6 +248,12 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
      */
     private Size initialTlabSize;
 
+    /**
+     * Bounds of the size of resized TLABs.
+     */
+    private Size minTlabSize;
+    private Size maxTlabSize;
+
     /*
      * TLAB statistics. For now, something simple shared by all threads without synchronization.
      * Will need to get per-thread, with statistics gathered globally at safepoint,
@@ -239,6 +274,11 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
          */
         volatile long tlabOverflowCount = 0L;
 
+        /**
+         * Count TLAB refills.
+         */
+        volatile long refillCount = 0L;
+
         /**
          * Leftover after refill.
          */
@@ -252,6 +292,8 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
             Log.println(runtimeSlowPathAllocateCount);
             Log.print("   tlab overflow count               :");
             Log.println(tlabOverflowCount);
+            Log.print("   tlab refill count                 :");
+            Log.println(refillCount);
             Log.print("   leftover at TLAB refill           :");
             if (leftover > Size.K.toLong()) {
                 Log.print(Size.K.plus(leftover).unsignedShiftedRight(10).toLong());
@@ -265,6 +307,11 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
 
     final TLABStats globalTlabStats = new TLABStats();
 
+    private static final PerfLong tlabFills = PerfMemory.createLong("sun.gc.tlab.fills",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_EVENTS);
+    private static final PerfLong tlabRefillWaste = PerfMemory.createLong("sun.gc.tlab.refillWaste",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_BYTES);
+
     @HOSTED_ONLY
     public HeapSchemeWithTLAB() {
     }
@@ -282,6 +329,18 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
             if (initialTlabSize.lessThan(0)) {
                 FatalError.unexpected("Specified TLAB size is too small");
             }
+            minTlabSize = initialTlabSize;
+            maxTlabSize = initialTlabSize;
+            if (ResizeTLAB) {
+                final Size minSize = minTlabSizeOption.getValue().alignUp(Word.size());
+                final Size maxSize = maxTlabSizeOption.getValue().alignDown(Word.size());
+                if (minSize.lessThan(initialTlabSize)) {
+                    minTlabSize = minSize;
+                }
+                if (maxSize.greaterThan(initialTlabSize)) {
+                    maxTlabSize = maxSize;
+                }
+            }
         } else if (phase == MaxineVM.Phase.RUNNING) {
             HeapSchemeWithTLAB.setTraceTLAB(false);
         } else if (phase == MaxineVM.Phase.TERMINATING) {
@@ -359,6 +418,33 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
 
     protected void setInitialTlabSize(Size size) {
         initialTlabSize = size;
+        if (minTlabSize.greaterThan(size)) {
+            minTlabSize = size;
+        }
+    }
+
+    /**
+     * Largest size a thread's TLAB may be resized to.
+     */
+    public Size maxTlabSize() {
+        return maxTlabSize;
+    }
+
+    /**
+     * Caps the size TLABs may be resized to, e.g., to keep them below a heap scheme's large object threshold.
+     */
+    protected void setMaxTlabSize(Size size) {
+        if (maxTlabSize.greaterThan(size)) {
+            maxTlabSize = size.lessThan(initialTlabSize) ? initialTlabSize : size;
+        }
+    }
+
+    /**
+     * Creates the refill policy for a thread whose first TLAB has just been filled.
+     * @param tlabSize size of the thread's first TLAB
+     */
+    protected final TLABRefillPolicy newTlabRefillPolicy(Size tlabSize) {
+        return new SimpleTLABRefillPolicy(tlabSize, minTlabSize, maxTlabSize, TLABRefillTarget);
     }
 
     public void refillTLAB(Pointer tlab, Size size) {
@@ -381,14 +467,22 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
         final Pointer allocationMark = TLAB_MARK.load(etla);
         if (!allocationMark.isZero()) {
             final Pointer oldTop = TLAB_TOP.load(etla);
-            globalTlabStats.leftover += oldTop.minus(allocationMark).toLong();
+            final Size leftover = oldTop.minus(allocationMark).asSize();
+            globalTlabStats.leftover += leftover.toLong();
+            tlabRefillWaste.add(leftover.toLong());
             // It is a refill, not an initial fill. So invoke handler.
             doBeforeTLABRefill(allocationMark, oldTop);
+            final TLABRefillPolicy refillPolicy = TLABRefillPolicy.getForCurrentThread(etla);
+            if (refillPolicy != null) {
+                refillPolicy.notifyRefill(size, leftover);
+            }
         } else {
             ProgramError.check(CUSTOM_ALLOCATION_ENABLED.load(etla).isZero(),
                 "Must not refill TLAB when in custom allocator is set");
         }
 
+        globalTlabStats.refillCount++;
+        tlabFills.increment();
         TLAB_TOP.store(etla, tlabTop);
         TLAB_MARK.store(etla, tlab);
         if (logTLAB()) {
@@ -603,6 +697,74 @@ public abstract class HeapSchemeWithTLAB extends HeapSchemeAdaptor {
         }
     }
 
+    /**
+     * Allocates all the arrays of a multi-dimensional array with a single bump of the current thread's TLAB,
+     * provided they all fit in the space left in it. The arrays are laid out one dimension after the other.
+     * Debug builds and profiled allocations take the regular path as every cell must then be tagged and reported.
+     */
+    @Override
+    @NO_SAFEPOINT_POLLS("object allocation and initialization must be atomic")
+    public final Object createMultiArray(DynamicHub hub, int[] lengths) {
+        if (MaxineVM.isDebug() || NUMAProfiler.shouldProfile()) {
+            return null;
+        }
+        final Pointer etla = ETLA.load(currentTLA());
+        final Pointer tlabTop = TLAB_TOP.load(etla);
+        if (tlabTop.isZero()) {
+            return null;
+        }
+        final long space = tlabTop.minus(TLAB_MARK.load(etla)).toLong();
+
+        // Total size of the arrays, and number of dimensions that have arrays to allocate.
+        long totalSize = 0L;
+        long numArrays = 1L;
+        int dimensions = 0;
+        DynamicHub levelHub = hub;
+        while (true) {
+            final int length = lengths[dimensions];
+            totalSize += numArrays * Layout.getArraySize(levelHub.classActor.componentClassActor().kind, length).toLong();
+            if (totalSize > space) {
+                return null;
+            }
+            dimensions++;
+            if (length == 0 || dimensions == lengths.length) {
+                break;
+            }
+            numArrays *= length;
+            levelHub = UnsafeCast.asDynamicHub(levelHub.componentHub);
+        }
+        // Fits in the TLAB, so this won't take the slow path.
+        Pointer cell = tlabAllocate(Size.fromLong(totalSize));
+
+        final Size outerSize = Layout.getArraySize(hub.classActor.componentClassActor().kind, lengths[0]);
+        final Object result = Cell.plantArray(cell, outerSize, hub, lengths[0]);
+        Pointer parentCell = cell;
+        Size parentSize = outerSize;
+        long numParents = 1L;
+        cell = cell.plus(outerSize);
+        DynamicHub parentHub = hub;
+        for (int d = 1; d < dimensions; d++) {
+            final int parentLength = lengths[d - 1];
+            final int length = lengths[d];
+            final DynamicHub childHub = UnsafeCast.asDynamicHub(parentHub.componentHub);
+            final Size childSize = Layout.getArraySize(childHub.classActor.componentClassActor().kind, length);
+            final Pointer firstChildCell = cell;
+            for (long p = 0; p < numParents; p++) {
+                final Object parent = Reference.fromOrigin(Layout.arrayCellToOrigin(parentCell)).toJava();
+                for (int i = 0; i < parentLength; i++) {
+                    ArrayAccess.setObject(parent, i, Cell.plantArray(cell, childSize, childHub, length));
+                    cell = cell.plus(childSize);
+                }
+                parentCell = parentCell.plus(parentSize);
+            }
+            numParents *= parentLength;
+            parentCell = firstChildCell;
+            parentSize = childSize;
+            parentHub = childHub;
+        }
+        return result;
+    }
+
     @NO_SAFEPOINT_POLLS("object allocation and initialization must be atomic")
     public final Object createHybrid(DynamicHub hub) {
         final Size size = hub.tupleSize;
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package com.sun.max.vm.heap;
+
+import java.util.*;
+
+import com.sun.max.annotate.*;
+import com.sun.max.unsafe.*;
+import com.sun.max.vm.*;
+import com.sun.max.vm.MaxineVM.Phase;
+import com.sun.max.vm.actor.holder.*;
+
+/**
+ * Number of live instances and bytes per class, computed by the heap marker as a side effect of marking.
+ * <p>
+ * When {@code -XX:+ClassHistogram} is specified, the marker calls {@link #record(Hub, Size)} for every object it
+ * blackens, between {@link #beginMarking()} and {@link #endMarking()}. Counters are indexed by
+ * {@linkplain ClassActor#id class identifier} in a single table holding, for each class, an instance count followed
+ * by a byte count. The table remains valid until the next marking starts, so reading the histogram costs no pause.
+ * <p>
+ * The table is sized at {@linkplain Phase#PRISTINE pristine} initialization and grown outside of GC, when
+ * {@linkplain ClassIDManager class identifiers are allocated}. Objects of classes whose identifier does not fit are
+ * accounted for in a single overflow entry.
+ * <p>
+ * Marking runs while mutators are stopped. A mutator copying or growing the table detects a marking that started
+ * meanwhile, at a safepoint in the copy, with {@link #epoch} and starts over.
+ */
+public final class LiveClassHistogram {
+
+    private LiveClassHistogram() {
+    }
+
+    public static boolean ClassHistogram;
+
+    static {
+        VMOptions.addFieldOption("-XX:", "ClassHistogram", LiveClassHistogram.class,
+                        "Compute a histogram of live objects per class when marking the heap", Phase.PRISTINE);
+    }
+
+    /**
+     * Instance and byte counts per class identifier, interleaved.
+     */
+    private static long[] table;
+
+    private static long overflowInstances;
+    private static long overflowBytes;
+
+    /**
+     * Incremented at the beginning and at the end of each marking.
+     */
+    private static volatile int epoch;
+
+    /**
+     * Number of markings that produced a histogram.
+     */
+    private static int histogramCount;
+
+    /**
+     * Sizes the table for all the class identifiers allocated so far, including those of the boot image, which are
+     * allocated before the heap can grow the table.
+     */
+    public static void initialize(Phase phase) {
+        if (phase == Phase.PRISTINE && ClassHistogram) {
+            synchronized (ClassIDManager.class) {
+                table = new long[2 * (ClassIDManager.largestClassId() + 1)];
+            }
+        }
+    }
+
+    /**
+     * Makes room in the table for the class identifier {@code id}. Called with the class identifier allocation lock
+     * held, from a thread that can allocate. Identifiers allocated before the table is {@linkplain #initialize sized}
+     * are accounted for when it is.
+     */
+    public static void ensureCapacity(int id) {
+        long[] t = table;
+        if (t == null || 2 * id < t.length) {
+            return;
+        }
+        final int length = Math.max(2 * (id + 1), 2 * t.length);
+        while (true) {
+            final int e = epoch;
+            final long[] grown = new long[length];
+            t = table;
+            System.arraycopy(t, 0, grown, 0, t.length);
+            if (epoch == e) {
+                table = grown;
+                return;
+            }
+        }
+    }
+
+    public static void beginMarking() {
+        epoch++;
+        final long[] t = table;
+        if (t != null) {
+            Arrays.fill(t, 0L);
+        }
+        overflowInstances = 0L;
+        overflowBytes = 0L;
+    }
+
+    @INLINE
+    public static void record(Hub hub, Size size) {
+        final int index = 2 * hub.classActor.id;
+        final long[] t = table;
+        if (t != null && index < t.length) {
+            t[index]++;
+            t[index + 1] += size.toLong();
+        } else {
+            overflowInstances++;
+            overflowBytes += size.toLong();
+        }
+    }
+
+    public static void endMarking() {
+        histogramCount++;
+        epoch++;
+    }
+
+    /**
+     * Live instances and bytes of one class.
+     */
+    public static final class Entry {
+        /**
+         * The class, or {@code null} for objects of classes not covered by the table.
+         */
+        public final ClassActor classActor;
+        public final long instances;
+        public final long bytes;
+
+        Entry(ClassActor classActor, long instances, long bytes) {
+            this.classActor = classActor;
+            this.instances = instances;
+            this.bytes = bytes;
+        }
+    }
+
+    private static final Comparator<Entry> BY_BYTES = new Comparator<Entry>() {
+        public int compare(Entry e1, Entry e2) {
+            return e1.bytes < e2.bytes ? 1 : (e1.bytes > e2.bytes ? -1 : 0);
+        }
+    };
+
+    /**
+     * Gets a copy of the histogram produced by the last completed marking, sorted by decreasing number of bytes.
+     *
+     * @return the histogram, or {@code null} if the histogram is disabled or no marking completed yet
+     */
+    public static Entry[] snapshot() {
+        if (!ClassHistogram) {
+            return null;
+        }
+        while (true) {
+            if (histogramCount == 0) {
+                return null;
+            }
+            final int e = epoch;
+            final long[] t = table;
+            final long[] copy = t == null ? new long[0] : t.clone();
+            final long otherInstances = overflowInstances;
+            final long otherBytes = overflowBytes;
+            if (epoch != e) {
+                continue;
+            }
+            final ArrayList<Entry> entries = new ArrayList<Entry>();
+            for (int index = 0; index < copy.length; index += 2) {
+                if (copy[index] != 0L) {
+                    entries.add(new Entry(ClassIDManager.toClassActor(index / 2), copy[index], copy[index + 1]));
+                }
+            }
+            if (otherInstances != 0L) {
+                entries.add(new Entry(null, otherInstances, otherBytes));
+            }
+            final Entry[] result = entries.toArray(new Entry[entries.size()]);
+            Arrays.sort(result, BY_BYTES);
+            return result;
+        }
+    }
+
+    /**
+     * Prints the histogram of the last completed marking to the {@linkplain Log log stream}.
+     */
+    public static void print() {
+        final Entry[] entries = snapshot();
+        if (entries == null) {
+            return;
+        }
+        long totalInstances = 0L;
+        long totalBytes = 0L;
+        Log.println();
+        Log.println(" num     #instances         #bytes  class name");
+        Log.println("----------------------------------------------");
+        for (int i = 0; i < entries.length; i++) {
+            final Entry entry = entries[i];
+            printRightAligned(i + 1, 4);
+            Log.print(": ");
+            printRightAligned(entry.instances, 14);
+            Log.print(' ');
+            printRightAligned(entry.bytes, 14);
+            Log.print("  ");
+            Log.println(entry.classActor == null ? "<classes not covered by the histogram>" : entry.classActor.name.string);
+            totalInstances += entry.instances;
+            totalBytes += entry.bytes;
+        }
+        Log.print("Total ");
+        printRightAligned(totalInstances, 14);
+        Log.print(' ');
+        printRightAligned(totalBytes, 14);
+        Log.println();
+    }
+
+    /**
+     * Prints a non-negative value padded with leading spaces to at least {@code width} characters.
+     */
+    private static void printRightAligned(long value, int width) {
+        int digits = 1;
+        for (long v = value; v >= 10L; v /= 10L) {
+            digits++;
+        }
+        for (int i = digits; i < width; i++) {
+            Log.print(' ');
+        }
+        Log.print(value);
+    }
+}
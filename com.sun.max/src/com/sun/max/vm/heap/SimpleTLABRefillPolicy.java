@@ -23,6 +23,8 @@
 package com.sun.max.vm.heap;
 
 import com.sun.max.unsafe.*;
+import com.sun.max.vm.*;
+import com.sun.max.vm.thread.*;
 
 /**
  * A policy object that helps with taking decisions with respect to when to refill a tlab on allocation failure, what size the tlab should have on next refill etc....
@@ -43,6 +45,11 @@ public class SimpleTLABRefillPolicy extends TLABRefillPolicy {
      */
     static final int TLAB_REFILL_RATIO = 10;
 
+    /**
+     * Weight (in percent) given to the last GC cycle in the average allocation of the thread between GCs.
+     */
+    static final int TLAB_ALLOCATION_WEIGHT = 35;
+
     /**
      * Size the TLAB should have on next refill.
      */
@@ -64,11 +71,56 @@ public class SimpleTLABRefillPolicy extends TLABRefillPolicy {
      */
     private Pointer lastMark;
 
+    /**
+     * Bounds of the TLAB size. The size is fixed if they are equal.
+     */
+    private final Size minSize;
+    private final Size maxSize;
+
+    /**
+     * Number of refills the TLAB size aims for between two GCs.
+     */
+    private final int refillTarget;
+
+    /**
+     * Average number of bytes the thread allocated in TLABs between two GCs, or -1 before the first GC.
+     */
+    private long averageAllocation = -1L;
+
+    /*
+     * Statistics since the last GC.
+     */
+    private long tlabBytes;
+    private long waste;
+    private int refills;
+    private int slowAllocations;
+
+    /*
+     * Statistics since the thread started.
+     */
+    private long totalWaste;
+    private long totalRefills;
+    private long totalSlowAllocations;
+
     public SimpleTLABRefillPolicy(Size initialTLABSize) {
+        this(initialTLABSize, initialTLABSize, initialTLABSize, 1);
+    }
+
+    /**
+     * Creates a policy that resizes the thread's TLAB at every GC so that the thread needs about {@code refillTarget}
+     * refills to allocate what it allocated on average between previous GCs.
+     * The policy is created right after the thread's first TLAB was filled, which is accounted for here.
+     */
+    public SimpleTLABRefillPolicy(Size initialTLABSize, Size minTLABSize, Size maxTLABSize, int refillTarget) {
         lastMark = Pointer.zero();
         allocationFailures = 0;
         nextSize = initialTLABSize;
         refillThreshold = initialTLABSize.dividedBy(TLAB_REFILL_RATIO);
+        minSize = minTLABSize;
+        maxSize = maxTLABSize;
+        this.refillTarget = refillTarget < 1 ? 1 : refillTarget;
+        tlabBytes = initialTLABSize.toLong();
+        refills = 1;
     }
 
     @Override
@@ -90,16 +142,77 @@ public class SimpleTLABRefillPolicy extends TLABRefillPolicy {
         if (!lastMark.equals(allocationMark)) {
             lastMark = allocationMark;
             allocationFailures = 1;
+            slowAllocations++;
             return false;
         }
         allocationFailures++;
-        return allocationFailures > TLAB_NUM_ALLOCATION_FAILURES_PER_MARK;
+        if (allocationFailures > TLAB_NUM_ALLOCATION_FAILURES_PER_MARK) {
+            return true;
+        }
+        slowAllocations++;
+        return false;
     }
 
     @Override
     public Size nextTlabSize() {
-        // Currently, nothing fancy. Just always returns the initial TLAB size value.
         return nextSize;
     }
 
+    @Override
+    public void notifyRefill(Size tlabSize, Size leftover) {
+        tlabBytes += tlabSize.toLong();
+        waste += leftover.toLong();
+        refills++;
+    }
+
+    @Override
+    public void notifyReset(Size leftover) {
+        waste += leftover.toLong();
+        if (minSize.lessThan(maxSize)) {
+            resize();
+        }
+        totalWaste += waste;
+        totalRefills += refills;
+        totalSlowAllocations += slowAllocations;
+        tlabBytes = 0L;
+        waste = 0L;
+        refills = 0;
+        slowAllocations = 0;
+    }
+
+    /**
+     * Sizes the next TLABs from the thread's average allocation between GCs. Space wasted at TLAB retirement
+     * doesn't count as allocation, so a thread that retires TLABs mostly unused gets smaller ones.
+     */
+    private void resize() {
+        final long allocated = Math.max(tlabBytes - waste, 0L);
+        if (averageAllocation < 0L) {
+            averageAllocation = allocated;
+        } else {
+            averageAllocation = (averageAllocation * (100 - TLAB_ALLOCATION_WEIGHT) + allocated * TLAB_ALLOCATION_WEIGHT) / 100;
+        }
+        Size size = Size.fromLong(averageAllocation / refillTarget).alignUp(Word.size());
+        if (size.lessThan(minSize)) {
+            size = minSize;
+        } else if (size.greaterThan(maxSize)) {
+            size = maxSize;
+        }
+        nextSize = size;
+        refillThreshold = size.dividedBy(TLAB_REFILL_RATIO);
+    }
+
+    @Override
+    public void printStats(VmThread vmThread) {
+        Log.print("TLAB: ");
+        Log.printThread(vmThread, false);
+        Log.print(" size: ");
+        Log.print(nextSize.toLong());
+        Log.print(" refills: ");
+        Log.print(totalRefills);
+        Log.print(" waste: ");
+        Log.print(totalWaste);
+        Log.print(" slow allocations: ");
+        Log.println(totalSlowAllocations);
+    }
+
 }
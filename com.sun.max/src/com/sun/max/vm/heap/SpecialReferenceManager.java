@@ -24,6 +24,8 @@ package com.sun.max.vm.heap;
 import static com.sun.max.vm.intrinsics.MaxineIntrinsicIDs.*;
 import static com.sun.max.vm.jdk.JDK_java_lang_ref_ReferenceQueue.*;
 
+import java.util.concurrent.locks.*;
+
 import com.sun.max.annotate.*;
 import com.sun.max.unsafe.*;
 import com.sun.max.vm.*;
@@ -35,11 +37,14 @@ import com.sun.max.vm.jdk.*;
 import com.sun.max.vm.layout.*;
 import com.sun.max.vm.log.VMLog.*;
 import com.sun.max.vm.log.hosted.*;
+import com.sun.max.vm.management.*;
 import com.sun.max.vm.monitor.modal.sync.*;
 import com.sun.max.vm.object.*;
 import com.sun.max.vm.reference.*;
 import com.sun.max.vm.runtime.*;
 import com.sun.max.vm.thread.*;
+import com.sun.max.vm.type.*;
+import com.sun.max.vm.value.*;
 
 /**
  * This class implements support for collecting and processing special references
@@ -52,6 +57,33 @@ public class SpecialReferenceManager {
 
     private static final boolean FINALIZERS_SUPPORTED = true;
 
+    private static int FinalizerThreads = 1;
+    private static int ReferenceHandlerThreads = 1;
+    private static int FinalizerBacklogThreshold;
+    private static int FinalizerBacklogMaxStall = 10;
+    static {
+        VMOptions.addFieldOption("-XX:", "FinalizerThreads", SpecialReferenceManager.class,
+            "Number of threads running finalizers.", Phase.PRISTINE);
+        VMOptions.addFieldOption("-XX:", "ReferenceHandlerThreads", SpecialReferenceManager.class,
+            "Number of threads enqueuing pending references and running cleaners.", Phase.PRISTINE);
+        VMOptions.addFieldOption("-XX:", "FinalizerBacklogThreshold", SpecialReferenceManager.class,
+            "Stall threads allocating finalizable objects while more than <n> finalizers wait to run (0 to never stall).", Phase.PRISTINE);
+        VMOptions.addFieldOption("-XX:", "FinalizerBacklogMaxStall", SpecialReferenceManager.class,
+            "Maximum time in milliseconds a thread is stalled per finalizable allocation because of the finalizer backlog.", Phase.PRISTINE);
+    }
+
+    /**
+     * The number of finalizers waiting in the finalizer queue.
+     */
+    public static final PerfLong finalizerQueueLength = PerfMemory.createLong("sun.gc.finalizer.queueLength",
+        PerfMemory.VARIABILITY_VARIABLE, PerfMemory.UNITS_EVENTS);
+
+    /**
+     * The number of finalizers run.
+     */
+    public static final PerfLong finalizersRun = PerfMemory.createLong("sun.gc.finalizer.completed",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_EVENTS);
+
     /**
      * This interface forms a contract between the GC algorithm and the implementation of special references.
      */
@@ -354,6 +386,25 @@ public class SpecialReferenceManager {
             if (specialReferenceLogger.enabled()) {
                 specialReferenceLogger.logRegisterFinalizee(Reference.fromJava(object).toOrigin(), ObjectAccess.readClassActor(object));
             }
+            if (FinalizerBacklogThreshold > 0 && sun.misc.VM.getFinalRefCount() > FinalizerBacklogThreshold) {
+                throttleFinalizableAllocation();
+            }
+        }
+    }
+
+    /**
+     * Stalls the current thread until the finalizer backlog drops to {@code -XX:FinalizerBacklogThreshold}
+     * or for at most {@code -XX:FinalizerBacklogMaxStall} milliseconds, so that threads creating
+     * finalizable objects cannot outrun the finalizer threads indefinitely.
+     * Finalizers that allocate finalizable objects are never stalled.
+     */
+    private static void throttleFinalizableAllocation() {
+        if (JDK.java_lang_ref_Finalizer$FinalizerThread.javaClass().isInstance(Thread.currentThread())) {
+            return;
+        }
+        final long deadline = System.nanoTime() + FinalizerBacklogMaxStall * 1000000L;
+        while (sun.misc.VM.getFinalRefCount() > FinalizerBacklogThreshold && System.nanoTime() < deadline) {
+            LockSupport.parkNanos(1000000L);
         }
     }
 
@@ -370,7 +421,9 @@ public class SpecialReferenceManager {
      * VM, the {@link java.lang.ref.Reference} and {@link java.lang.ref.Finalizer} classes create
      * threads in their static initializers to handle weak references and finalizable objects.
      * However, in the target VM, these classes have already been initialized and these
-     * threads need to be started manually.
+     * threads need to be started manually. Any additional threads requested by
+     * {@code -XX:ReferenceHandlerThreads} and {@code -XX:FinalizerThreads} are started
+     * once the VM is running.
      *
      * @param phase the phase in which the VM is in
      */
@@ -385,6 +438,8 @@ public class SpecialReferenceManager {
             assert sentinelAlias.isInactive();
             startReferenceHandlerThread();
             startFinalizerThread();
+        } else if (phase == Phase.RUNNING) {
+            startAdditionalThreads();
         }
     }
 
@@ -419,6 +474,37 @@ public class SpecialReferenceManager {
         }
     }
 
+    /**
+     * Starts the reference handler and finalizer threads beyond the first. They are further
+     * instances of the JDK's thread classes and drain the same pending list and finalizer queue.
+     */
+    private static void startAdditionalThreads() {
+        final Thread referenceHandler = VmThread.referenceHandlerThread.javaThread();
+        final Thread finalizer = VmThread.finalizerThread.javaThread();
+        final ReferenceValue group = ReferenceValue.from(referenceHandler.getThreadGroup());
+        try {
+            for (int i = 1; i < ReferenceHandlerThreads; i++) {
+                final String name = referenceHandler.getName() + "-" + i;
+                startAdditionalThread((Thread) ClassRegistry.ReferenceHandler_init.invokeConstructor(group, ReferenceValue.from(name)).asObject(), referenceHandler);
+            }
+            if (FINALIZERS_SUPPORTED) {
+                for (int i = 1; i < FinalizerThreads; i++) {
+                    final Thread thread = (Thread) ClassRegistry.FinalizerThread_init.invokeConstructor(group).asObject();
+                    thread.setName(finalizer.getName() + "-" + i);
+                    startAdditionalThread(thread, finalizer);
+                }
+            }
+        } catch (Exception e) {
+            throw FatalError.unexpected("Error starting reference processing threads", e);
+        }
+    }
+
+    private static void startAdditionalThread(Thread thread, Thread model) {
+        thread.setPriority(model.getPriority());
+        thread.setDaemon(true);
+        thread.start();
+    }
+
     // Logging
 
     public static final SpecialReferenceLogger specialReferenceLogger = new SpecialReferenceLogger();
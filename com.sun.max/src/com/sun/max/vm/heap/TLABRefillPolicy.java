@@ -65,6 +65,27 @@ public abstract class TLABRefillPolicy {
      */
     public abstract Size nextTlabSize();
 
+    /**
+     * Notifies the policy that the current thread's TLAB was refilled.
+     * @param tlabSize size of the new TLAB
+     * @param leftover space left unused in the retired TLAB
+     */
+    public void notifyRefill(Size tlabSize, Size leftover) {
+    }
+
+    /**
+     * Notifies the policy that the thread's TLAB was reset, either for a GC or because the thread is detaching.
+     * @param leftover space left unused in the reset TLAB
+     */
+    public void notifyReset(Size leftover) {
+    }
+
+    /**
+     * Prints the policy's statistics for the thread it is associated with.
+     */
+    public void printStats(VmThread vmThread) {
+    }
+
     @INTRINSIC(UNSAFE_CAST)
     private static native TLABRefillPolicy asTLABRefillPolicy(Object object);
 
@@ -49,6 +49,15 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
     @INSPECTED
     private Address start; // keep it private, so the only way to update it is via refill / reset / clear methods.
 
+    /**
+     * Lowest address of the tail of the current chunk known to hold only zeros, i.e., memory that the OS committed
+     * and that was never handed out since. Cells allocated above it need no clearing.
+     * {@link Address#max()} when nothing is known about the content of the chunk.
+     * Only ever lowered when no concurrent allocation can take place (refill with zeroed memory, grow);
+     * concurrent updates only raise it.
+     */
+    private volatile Address zeroedFrom = Address.max();
+
     protected final T refillManager;
 
     /**
@@ -62,6 +71,11 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
         return ClassActor.fromJava(BaseAtomicBumpPointerAllocator.class).findLocalInstanceFieldActor("top").offset();
     }
 
+    @FOLD
+    private static int zeroedFromOffset() {
+        return ClassActor.fromJava(BaseAtomicBumpPointerAllocator.class).findLocalInstanceFieldActor("zeroedFrom").offset();
+    }
+
     @FOLD
     public static Size headroom() {
         return ClassActor.fromJava(Object.class).dynamicHub().tupleSize;
@@ -98,6 +112,9 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
 
     public final void unsafeSetTop(Address newTop) {
         FatalError.check(inCurrentContiguousChunk(newTop), "top must be within allocating chunk");
+        if (zeroedFrom.lessThan(newTop)) {
+            zeroedFrom = newTop;
+        }
         top = newTop;
     }
 
@@ -112,6 +129,7 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
     }
 
     protected final void clear() {
+        zeroedFrom = Address.max();
         start = Address.zero();
         end = Address.zero();
         top = Address.zero();
@@ -140,11 +158,22 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
     }
 
     public void initialize(Address initialChunk, Size initialChunkSize, Size sizeLimit) {
+        initialize(initialChunk, initialChunkSize, sizeLimit, false);
+    }
+
+    /**
+     * Initialize the allocator.
+     * @param initialChunk first chunk to allocate from, or zero if the allocator should start empty
+     * @param initialChunkSize size of the first chunk
+     * @param sizeLimit maximum size of the requests the allocator serves from its chunk
+     * @param zeroed true if the initial chunk is freshly committed memory that was never written to
+     */
+    public void initialize(Address initialChunk, Size initialChunkSize, Size sizeLimit, boolean zeroed) {
         this.sizeLimit = sizeLimit;
         if (initialChunk.isZero()) {
             clear();
         } else {
-            refill(initialChunk, initialChunkSize);
+            refill(initialChunk, initialChunkSize, zeroed);
         }
     }
 
@@ -153,6 +182,7 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
     }
 
     public final void reset() {
+        zeroedFrom = Address.max();
         top = start;
     }
 
@@ -160,8 +190,13 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
      * Grow the allocator's contiguous chunk of memory.
      * Not multi-thread safe.
      * @param delta number of bytes to grow the allocator's backing storage with
+     * @param zeroed true if the added backing storage was just committed by the OS and is therefore zero-filled
      */
-    public final void grow(Size delta) {
+    public final void grow(Size delta, boolean zeroed) {
+        final Address oldHardLimit = hardLimit();
+        if (zeroed && zeroedFrom.greaterThan(oldHardLimit)) {
+            zeroedFrom = oldHardLimit;
+        }
         end = end.plus(delta);
     }
 
@@ -206,6 +241,21 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
     }
 
     public final void refill(Address chunk, Size chunkSize) {
+        refill(chunk, chunkSize, false);
+    }
+
+    /**
+     * Refill the allocator with a new chunk of memory.
+     * A zeroed chunk must only be passed when no concurrent allocation can take place, as threads still
+     * clearing cells of the previous chunk may otherwise see the new chunk's {@link #zeroedFrom}.
+     *
+     * @param chunk start of the chunk
+     * @param chunkSize size of the chunk in bytes
+     * @param zeroed true if the chunk is freshly committed memory that was never written to
+     */
+    public final void refill(Address chunk, Size chunkSize, boolean zeroed) {
+        // Forget what is known about zeroed memory before the new chunk becomes visible to allocating threads.
+        zeroedFrom = zeroed ? chunk : Address.max();
         // Make sure we can cause any attempt to allocate to fail, regardless of the
         // value of top
         end = Address.zero();
@@ -248,6 +298,15 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
     public final boolean retireTop(Address retiredTop, Size retiredSize) {
         final Pointer thisAddress = Reference.fromJava(this).toOrigin();
         final Address oldTop = retiredTop.plus(retiredSize);
+        // The retired space was handed out and may have been written to: it can't be treated as zeroed
+        // if it is allocated again. A concurrent refill only sets zeroedFrom to the maximum address, so losing the race is fine.
+        Address zeroed = zeroedFrom;
+        while (zeroed.lessThan(oldTop)) {
+            if (thisAddress.compareAndSwapWord(zeroedFromOffset(), zeroed, oldTop).equals(zeroed)) {
+                break;
+            }
+            zeroed = zeroedFrom;
+        }
         Address cell;
         do {
             cell = top;
@@ -278,6 +337,7 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
      * This is unsafe and should only be used when non concurrent allocation can take place.
      */
     final void unsafeMakeParsable() {
+        zeroedFrom = Address.max();
         final Address cell = top;
         if (cell.isNotZero()) {
             Address hardLimit = hardLimit();
@@ -333,9 +393,21 @@ public abstract class BaseAtomicBumpPointerAllocator<T extends Refiller> {
         }
     }
 
+    /**
+     * Zero-fill a freshly allocated cell, skipping the part of it that lies in memory known to be zero already.
+     * The hard limit is read before {@link #zeroedFrom} so that a cell allocated outside of the current chunk
+     * (e.g., a large object) is never mistaken for one of its untouched cells.
+     */
     @INLINE
     final protected Pointer clearAllocatedCell(Pointer cell, Size size) {
-        Memory.clearWords(cell, size.unsignedShiftedRight(Word.widthValue().log2numberOfBytes).toInt());
+        final Address hardLimit = hardLimit();
+        final Address zeroed = zeroedFrom;
+        final Address cellEnd = cell.plus(size);
+        Size dirtySize = size;
+        if (cellEnd.greaterThan(zeroed) && cellEnd.lessEqual(hardLimit)) {
+            dirtySize = cell.lessThan(zeroed) ? zeroed.minus(cell).asSize() : Size.zero();
+        }
+        Memory.clearWords(cell, dirtySize.unsignedShiftedRight(Word.widthValue().log2numberOfBytes).toInt());
         return cell;
     }
 
@@ -37,8 +37,41 @@ import com.sun.max.vm.runtime.*;
 public abstract class HeapSchemeWithTLABAdaptor extends HeapSchemeWithTLAB {
     protected static boolean VerifyAfterGC = false;
 
+    /**
+     * Period, in collections, of after-GC verification. Verifying every n-th collection only keeps the average
+     * pause time close to that of an unverified run while still eventually checking every kind of collection.
+     * <p>
+     * Verification always runs inside the pause of the collection it checks. The verifiers check invariants that
+     * only hold right after a collection (e.g., an empty nursery after evacuation, no reference into evacuated
+     * space), and once mutators resume they allocate into reclaimed space and overwrite references, so the heap
+     * can neither be walked concurrently nor checked at a later safepoint.
+     */
+    protected static int VerifyAfterGCInterval = 1;
+
     static {
         VMOptions.addFieldOption("-XX:", "VerifyAfterGC", HeapSchemeWithTLABAdaptor.class, "Verify heap after GC", Phase.PRISTINE);
+        VMOptions.addFieldOption("-XX:", "VerifyAfterGCInterval", HeapSchemeWithTLABAdaptor.class,
+                        "With -XX:+VerifyAfterGC, only verify the heap after every n-th GC", Phase.PRISTINE);
+    }
+
+    /**
+     * Number of collections since the heap was last verified.
+     */
+    private static int collectionsSinceVerification;
+
+    /**
+     * Determines whether the heap is to be verified after the current collection. Must be called exactly once per
+     * collection, before any of its verification points.
+     */
+    protected static boolean verifyAfterThisGC() {
+        if (!VerifyAfterGC) {
+            return false;
+        }
+        if (++collectionsSinceVerification < VerifyAfterGCInterval) {
+            return false;
+        }
+        collectionsSinceVerification = 0;
+        return true;
     }
 
     /**
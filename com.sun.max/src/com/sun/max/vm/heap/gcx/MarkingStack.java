@@ -87,7 +87,7 @@ public class MarkingStack {
         // Same with the other GC data structures (i.e., rescan map and mark bitmap)
         final int length = markingStackSizeOption.getValue();
         final int size = length << Word.widthValue().log2numberOfBytes;
-        base = Memory.allocate(Size.fromInt(size));
+        base = Memory.allocate(Size.fromInt(size), Memory.Category.GC, true);
         if (base.isZero()) {
             MaxineVM.reportPristineMemoryFailure("marking stack", "allocate", Size.fromInt(size));
         }
@@ -123,7 +123,7 @@ public final class NoAgingRegionalizedNursery implements HeapSpace {
         while (nurseryRegionsList.tail() != lastCommittedRegion) {
             uncommitedNurseryRegionsList.prepend(nurseryRegionsList.removeTail());
         }
-        allocator.initialize(RegionTable.theRegionTable().regionAddress(nurseryRegionsList.head()), genSizingPolicy.initialYoungGenSize(), Size.fromInt(HeapRegionConstants.regionSizeInBytes));
+        allocator.initialize(RegionTable.theRegionTable().regionAddress(nurseryRegionsList.head()), genSizingPolicy.initialYoungGenSize(), Size.fromInt(HeapRegionConstants.regionSizeInBytes), true);
     }
 
     public Pointer allocate(Size size) {
@@ -996,6 +996,9 @@ public class TricolorHeapMarker implements MarkingStack.OverflowHandler, HeapMan
                     markRefGrey(Layout.getReference(origin, index));
                 }
             }
+            if (LiveClassHistogram.ClassHistogram) {
+                LiveClassHistogram.record(hub, Layout.size(origin));
+            }
             heapMarker.traceBlackMark(cell, bitIndex);
             heapMarker.markBlackFromGrey(bitIndex);
         }
@@ -1153,6 +1156,10 @@ public class TricolorHeapMarker implements MarkingStack.OverflowHandler, HeapMan
                         SpecialReferenceManager.discoverSpecialReference(cell);
                     }
                 }
+                // A marking stack flush may already have visited, and accounted for, the cell.
+                if (LiveClassHistogram.ClassHistogram && !heapMarker.isBlackWhenNotWhite(cell)) {
+                    LiveClassHistogram.record(hub, hub.tupleSize);
+                }
                 return cell.plus(hub.tupleSize);
             }
             if (specificLayout.isReferenceArrayLayout()) {
@@ -1160,7 +1167,11 @@ public class TricolorHeapMarker implements MarkingStack.OverflowHandler, HeapMan
             } else if (specificLayout.isHybridLayout()) {
                 TupleReferenceMap.visitReferences(hub, origin, this);
             }
-            return cell.plus(Layout.size(origin));
+            final Size size = Layout.size(origin);
+            if (LiveClassHistogram.ClassHistogram && !heapMarker.isBlackWhenNotWhite(cell)) {
+                LiveClassHistogram.record(hub, size);
+            }
+            return cell.plus(size);
         }
 
         abstract  int rightmostBitmapWordIndex();
@@ -1782,6 +1793,9 @@ public class TricolorHeapMarker implements MarkingStack.OverflowHandler, HeapMan
             recoveryScanTimer.reset();
         }
         FatalError.check(markingStack.isEmpty(), "Marking stack must be empty");
+        if (LiveClassHistogram.ClassHistogram) {
+            LiveClassHistogram.beginMarking();
+        }
 
         clearColorMap();
         markRoots();
@@ -1813,6 +1827,9 @@ public class TricolorHeapMarker implements MarkingStack.OverflowHandler, HeapMan
         if (VerifyAfterMarking) {
             verifyHasNoGreyMarks(coveredAreaStart, forwardScanState.endOfRightmostVisitedObject());
         }
+        if (LiveClassHistogram.ClassHistogram) {
+            LiveClassHistogram.endMarking();
+        }
         markPhase = MARK_PHASE.DONE;
     }
 
@@ -1860,6 +1877,9 @@ public class TricolorHeapMarker implements MarkingStack.OverflowHandler, HeapMan
         if (traceGCTimes) {
             recoveryScanTimer.reset();
         }
+        if (LiveClassHistogram.ClassHistogram) {
+            LiveClassHistogram.beginMarking();
+        }
         if (MaxineVM.isDebug()) {
             MarkingError markFailure = null;
             try {
@@ -1906,6 +1926,9 @@ public class TricolorHeapMarker implements MarkingStack.OverflowHandler, HeapMan
         stopTimer(weakRefTimer);
         markPhase.traceEnd(traceGCPhases);
         FatalError.check(markingStack.isEmpty(), "Marking Stack must be empty after special references are processed.");
+        if (LiveClassHistogram.ClassHistogram) {
+            LiveClassHistogram.endMarking();
+        }
         markPhase = MARK_PHASE.DONE;
     }
 
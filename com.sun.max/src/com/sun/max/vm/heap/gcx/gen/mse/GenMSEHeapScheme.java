@@ -197,6 +197,8 @@ final public class GenMSEHeapScheme extends HeapSchemeWithTLABAdaptor  implement
         theHeapRegionManager().initialize(firstUnusedByteAddress, endOfReservedSpace, maxSize, HeapRegionInfo.class, BOOT.tag());
         // All reserved space (but the one used by the heap region manager) is now uncommitted.
         FatalError.check(HeapRegionConstants.log2RegionSizeInBytes >= heapMarker.log2BitmapWord, "Region size too small for heap marker");
+        // TLABs are carved out of a single region.
+        setMaxTlabSize(Size.fromInt(HeapRegionConstants.regionSizeInBytes));
 
         try {
             enableCustomAllocation(theHeapRegionManager().allocator());
@@ -328,6 +330,7 @@ final public class GenMSEHeapScheme extends HeapSchemeWithTLABAdaptor  implement
             // This requires evacuating all of its objects somehow. Rather that doing a full GC covering both
             // the old and young gen and somehow reclaim enough regions for a fresh nursery, we just perform a nursery evacuation.
             // The full GC is thereafter just a old gen GC with an empty young gen.
+            final boolean verify = verifyAfterThisGC();
             VmThreadMap.ACTIVE.forAllThreadLocals(null, tlabFiller);
             vmConfig().monitorScheme().beforeGarbageCollection();
             if (Heap.verbose()) {
@@ -341,7 +344,7 @@ final public class GenMSEHeapScheme extends HeapSchemeWithTLABAdaptor  implement
             if (Heap.verbose()) {
                 Log.println("--End nursery evacuation");
             }
-            if (VerifyAfterGC) {
+            if (verify) {
                 verifyAfterEvacuation();
             }
             Size worstCaseEvac = youngSpace.totalSpace();
@@ -356,7 +359,7 @@ final public class GenMSEHeapScheme extends HeapSchemeWithTLABAdaptor  implement
                     Log.println("--End   old geneneration collection");
                 }
 
-                if (VerifyAfterGC) {
+                if (verify) {
                     verifyAfterEvacuation();
                 }
                 freeSpace = oldSpace.freeSpace();
@@ -458,7 +461,7 @@ final public class GenMSEHeapScheme extends HeapSchemeWithTLABAdaptor  implement
             allocateAndRefillTLAB(etla, tlabSize);
             // Let's do a bit of meta-circularity. The TLAB is refilled, and no-one except the current thread can use it.
             // So the TLAB allocation is going to succeed here
-            TLABRefillPolicy.setForCurrentThread(etla, new SimpleTLABRefillPolicy(tlabSize));
+            TLABRefillPolicy.setForCurrentThread(etla, newTlabRefillPolicy(tlabSize));
             // Now, address the initial request. Note that we may recurse down to handleTLABOverflow again here if the
             // request is larger than the TLAB size. However, this second call will succeed and allocate outside of the TLAB.
             return tlabAllocate(size);
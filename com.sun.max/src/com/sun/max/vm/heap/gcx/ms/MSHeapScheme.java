@@ -303,7 +303,7 @@ public final class MSHeapScheme extends HeapSchemeWithTLABAdaptor {
             heapMarker.markAll();
             HeapScheme.Inspect.notifyHeapPhaseChange(HeapPhase.RECLAIMING);
             Size freeSpaceAfterGC = reclaim();
-            if (VerifyAfterGC) {
+            if (verifyAfterThisGC()) {
                 afterGCVerifier.run();
             }
             vmConfig().monitorScheme().afterGarbageCollection();
@@ -410,7 +410,7 @@ public final class MSHeapScheme extends HeapSchemeWithTLABAdaptor {
             allocateAndRefillTLAB(etla, tlabSize);
             // Let's do a bit of dirty meta-circularity. The TLAB is refilled, and no-one except the current thread can use it.
             // So the tlab allocation is going to succeed here
-            TLABRefillPolicy.setForCurrentThread(etla, new SimpleTLABRefillPolicy(tlabSize));
+            TLABRefillPolicy.setForCurrentThread(etla, newTlabRefillPolicy(tlabSize));
             // Now, address the initial request. Note that we may recurse down to handleTLABOverflow again here if the
             // request is larger than the TLAB size. However, this second call will succeed and allocate outside of the tlab.
             return tlabAllocate(size);
@@ -126,6 +126,8 @@ public final class MSEHeapScheme extends HeapSchemeWithTLABAdaptor implements He
         theHeapRegionManager().initialize(firstUnusedByteAddress, endOfReservedSpace, maxSize, HeapRegionInfo.class, 0);
         // All reserved space (but the one used by the heap region manager) is now uncommitted.
         FatalError.check(HeapRegionConstants.log2RegionSizeInBytes >= heapMarker.log2BitmapWord, "Region size too small for heap marker");
+        // TLABs are carved out of a single region.
+        setMaxTlabSize(Size.fromInt(HeapRegionConstants.regionSizeInBytes));
 
         try {
             enableCustomAllocation(theHeapRegionManager().allocator());
@@ -348,7 +350,7 @@ public final class MSEHeapScheme extends HeapSchemeWithTLABAdaptor implements He
                 Log.println("END: Sweeping");
             }
 
-            if (VerifyAfterGC) {
+            if (verifyAfterThisGC()) {
                 afterGCVerifier.run();
             }
             vmConfig().monitorScheme().afterGarbageCollection();
@@ -459,7 +461,7 @@ public final class MSEHeapScheme extends HeapSchemeWithTLABAdaptor implements He
             allocateAndRefillTLAB(etla, tlabSize);
             // Let's do a bit of dirty meta-circularity. The TLAB is refilled, and no-one except the current thread can use it.
             // So the tlab allocation is going to succeed here
-            TLABRefillPolicy.setForCurrentThread(etla, new SimpleTLABRefillPolicy(tlabSize));
+            TLABRefillPolicy.setForCurrentThread(etla, newTlabRefillPolicy(tlabSize));
             // Now, address the initial request. Note that we may recurse down to handleTLABOverflow again here if the
             // request is larger than the TLAB size. However, this second call will succeed and allocate outside of the tlab.
             return tlabAllocate(size);
@@ -56,7 +56,8 @@ public class ContiguousAllocatingSpace<T extends BaseAtomicBumpPointerAllocator<
     public void initialize(Address start, Size maxSize, Size initialSize) {
         space.setReserved(start, maxSize);
         space.growCommittedSpace(initialSize);
-        allocator.refill(start, initialSize);
+        // The backing storage hasn't been used yet and is still zero-filled.
+        allocator.refill(start, initialSize, true);
         // Inspector support:
         // Zero-fill  the first word of  the still virgin backing storage of the space to force the OS to map the first page in virtual memory.
         // This avoids the inspector to get DataIO Error on trying to read the bytes from the first page.
@@ -67,7 +68,8 @@ public class ContiguousAllocatingSpace<T extends BaseAtomicBumpPointerAllocator<
         final Size size = space.adjustGrowth(delta);
         boolean hasGrown = space.growCommittedSpace(size);
         FatalError.check(hasGrown, "request for growing space after GC must always succeed");
-        allocator.grow(size);
+        // Without anonymous memory operations the added storage may have been used before the space last shrunk.
+        allocator.grow(size, !Heap.AvoidsAnonOperations);
         return size;
     }
 
@@ -723,6 +723,7 @@ public final class GenSSHeapScheme extends HeapSchemeWithTLABAdaptor implements
             FatalError.breakpoint();
         }
         final boolean oldSpaceMutatorOverflow = oldSpace.allocator.refillManager().mutatorOverflow();
+        final boolean verify = verifyAfterThisGC();
 
         resizingPolicy.clearNotifications();
         youngSpaceEvacuator.enableDarkMatterRefCheck(MaxineVM.isDebug());
@@ -755,7 +756,7 @@ public final class GenSSHeapScheme extends HeapSchemeWithTLABAdaptor implements
         if (OldSpaceDirtyCardsStats) {
             countOldSpaceDirtyCards("after minor collection");
         }
-        if (VerifyAfterGC) {
+        if (verify) {
             verifyAfterMinorCollection();
         }
 
@@ -789,7 +790,7 @@ public final class GenSSHeapScheme extends HeapSchemeWithTLABAdaptor implements
             if (MaxineVM.isDebug() && Heap.verbose()) {
                 Log.println("--End   old generation collection");
             }
-            if (VerifyAfterGC) {
+            if (verify) {
                 verifyAfterFullCollection();
             }
             final GenSSGCRequest gcRequest = genCollection.gcRequest();
@@ -943,8 +944,10 @@ public final class GenSSHeapScheme extends HeapSchemeWithTLABAdaptor implements
                 final Size newTLABSize = Size.fromLong(Long.highestOneBit(largeObjectSizeThreshold.toLong()));
                 setInitialTlabSize(newTLABSize);
             }
+            setMaxTlabSize(largeObjectSizeThreshold);
             youngSpace.initialize(firstUnusedByteAddress, resizingPolicy.maxYoungGenSize(), resizingPolicy.initialYoungGenSize());
-            youngSpace.allocator().initialize(youngSpace.space.start(), youngSpace.space.committedSize(), largeObjectSizeThreshold);
+            // The nursery's backing storage was just committed and is still zero-filled.
+            youngSpace.allocator().initialize(youngSpace.space.start(), youngSpace.space.committedSize(), largeObjectSizeThreshold, true);
             Address startOfOldSpace = youngSpace.space.end().alignUp(pageSize);
             oldSpace.initialize(startOfOldSpace, resizingPolicy.maxOldGenSize(), resizingPolicy.initialOldGenSize());
             // Set old space's allocator size limit to the max old space size  to never call allocate large, but always refill instead.
@@ -1033,7 +1036,7 @@ public final class GenSSHeapScheme extends HeapSchemeWithTLABAdaptor implements
             allocateAndRefillTLAB(etla, tlabSize);
             // Let's do a bit of meta-circularity. The TLAB is refilled, and no-one except the current thread can use it.
             // So the TLAB allocation is going to succeed here
-            TLABRefillPolicy.setForCurrentThread(etla, new SimpleTLABRefillPolicy(tlabSize));
+            TLABRefillPolicy.setForCurrentThread(etla, newTlabRefillPolicy(tlabSize));
             // Now, address the initial request. Note that we may recurse down to handleTLABOverflow again here if the
             // request is larger than the TLAB size. However, this second call will succeed and allocate outside of the TLAB.
             return tlabAllocate(size);
@@ -206,7 +206,7 @@ public class MultiSemiSpaceHeapScheme extends HeapSchemeWithTLAB implements Cell
         if (phase == MaxineVM.Phase.PRISTINE) {
             allocateHeaps();
 
-            safetyZoneSize = Math.max(safetyZoneSizeOption.getValue(), initialTlabSize().toInt());
+            safetyZoneSize = Math.max(safetyZoneSizeOption.getValue(), maxTlabSize().toInt());
 
             for (int i = 0; i < NUMBER_OF_SPLITS; i++) {
                 final LinearAllocationMemoryRegion toSpace = toSpaces[i];
@@ -963,7 +963,7 @@ public class MultiSemiSpaceHeapScheme extends HeapSchemeWithTLAB implements Cell
             allocateAndRefillTLAB(etla, tlabSize);
             // Let's do a bit of meta-circularity. The TLAB is refilled, and no-one except the current thread can use it.
             // So the TLAB allocation is going to succeed here
-            TLABRefillPolicy.setForCurrentThread(etla, new SimpleTLABRefillPolicy(tlabSize));
+            TLABRefillPolicy.setForCurrentThread(etla, newTlabRefillPolicy(tlabSize));
             // Now, address the initial request. Note that we may recurse down to handleTLABOverflow again here if the
             // request is larger than the TLAB size. However, this second call will succeed and allocate outside of the TLAB.
             return tlabAllocate(size);
@@ -198,7 +198,7 @@ public class SemiSpaceHeapScheme extends HeapSchemeWithTLAB implements CellVisit
         if (phase == MaxineVM.Phase.PRISTINE) {
             allocateHeap();
 
-            safetyZoneSize = Math.max(safetyZoneSizeOption.getValue(), initialTlabSize().toInt());
+            safetyZoneSize = Math.max(safetyZoneSizeOption.getValue(), maxTlabSize().toInt());
 
             top = toSpace.end().minus(safetyZoneSize);
 
@@ -879,7 +879,7 @@ public class SemiSpaceHeapScheme extends HeapSchemeWithTLAB implements CellVisit
             allocateAndRefillTLAB(etla, tlabSize);
             // Let's do a bit of meta-circularity. The TLAB is refilled, and no-one except the current thread can use it.
             // So the TLAB allocation is going to succeed here
-            TLABRefillPolicy.setForCurrentThread(etla, new SimpleTLABRefillPolicy(tlabSize));
+            TLABRefillPolicy.setForCurrentThread(etla, newTlabRefillPolicy(tlabSize));
             // Now, address the initial request. Note that we may recurse down to handleTLABOverflow again here if the
             // request is larger than the TLAB size. However, this second call will succeed and allocate outside of the TLAB.
             return tlabAllocate(size);
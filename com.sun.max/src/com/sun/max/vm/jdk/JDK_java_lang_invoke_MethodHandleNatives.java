@@ -22,12 +22,14 @@
 package com.sun.max.vm.jdk;
 
 import static com.sun.max.vm.classfile.constant.ConstantPool.ReferenceKind.*;
+import static com.sun.max.vm.intrinsics.MaxineIntrinsicIDs.*;
 import static com.sun.max.vm.jdk.JDK_java_lang_invoke_MemberName.*;
 import static java.lang.invoke.MethodType.*;
 
 import java.lang.invoke.*;
 import java.lang.reflect.*;
 
+import com.oracle.max.cri.intrinsics.*;
 import com.sun.max.annotate.*;
 import com.sun.max.program.*;
 import com.sun.max.vm.actor.holder.*;
@@ -127,6 +129,39 @@ public final class JDK_java_lang_invoke_MethodHandleNatives {
     public static native Object linkCallSite(Object callerObj, Object bootstrapMethodObj, Object nameObj,
                                              Object typeObj, Object staticArguments, Object[] appendixResult);
 
+    /**
+     * Aliased members of CallSite.
+     */
+    static final class CallSiteAlias {
+        @INTRINSIC(UNSAFE_CAST)
+        static native CallSiteAlias asCallSiteAlias(Object callSite);
+
+        @ALIAS(declaringClass = CallSite.class)
+        MethodHandle target;
+    }
+
+    /**
+     * Retargets a {@link MutableCallSite} (or any other non-volatile call site).
+     * <p>
+     * Linked invokedynamic sites call through an invoker that reloads the target of a non-constant
+     * call site on each invocation, and no compiler folds that load, so there is no compiled code
+     * to invalidate here and a plain field store is sufficient.
+     */
+    @SUBSTITUTE
+    static void setCallSiteTargetNormal(CallSite site, MethodHandle target) {
+        CallSiteAlias.asCallSiteAlias(site).target = target;
+    }
+
+    /**
+     * Retargets a {@link VolatileCallSite}, with the memory barriers of a volatile store.
+     */
+    @SUBSTITUTE
+    static void setCallSiteTargetVolatile(CallSite site, MethodHandle target) {
+        MemoryBarriers.barrier(MemoryBarriers.JMM_PRE_VOLATILE_WRITE);
+        CallSiteAlias.asCallSiteAlias(site).target = target;
+        MemoryBarriers.barrier(MemoryBarriers.JMM_POST_VOLATILE_WRITE);
+    }
+
     /**
      * For a field MemberName, return the offset of the field in its holder.
      *
@@ -27,6 +27,7 @@ import com.sun.max.annotate.*;
 import com.sun.max.vm.*;
 import com.sun.max.vm.actor.holder.*;
 import com.sun.max.vm.actor.member.*;
+import com.sun.max.vm.heap.*;
 import com.sun.max.vm.object.*;
 import com.sun.max.vm.reference.*;
 import com.sun.max.vm.value.*;
@@ -80,6 +81,7 @@ final class JDK_java_lang_ref_Finalizer {
                 }
 
                 selectedMethod.invoke(ReferenceValue.from(finalizee));
+                SpecialReferenceManager.finalizersRun.increment();
                 /* Clear stack slot containing this variable, to decrease
                    the chances of false retention with a conservative GC */
                 finalizee = null;
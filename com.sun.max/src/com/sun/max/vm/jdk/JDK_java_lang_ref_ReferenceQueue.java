@@ -81,6 +81,7 @@ public final class JDK_java_lang_ref_ReferenceQueue {
                     queueLength++;
                     if (ClassRegistry.JLR_FINAL_REFERENCE.isInstance(r)) {
                         sun.misc.VM.addFinalRefCount(1);
+                        SpecialReferenceManager.finalizerQueueLength.increment();
                     }
                     lock.notifyAll();
                     if (SpecialReferenceManager.specialReferenceLogger.enabled()) {
@@ -105,6 +106,7 @@ public final class JDK_java_lang_ref_ReferenceQueue {
                 queueLength++;
                 if (ClassRegistry.JLR_FINAL_REFERENCE.isInstance(r)) {
                     sun.misc.VM.addFinalRefCount(1);
+                    SpecialReferenceManager.finalizerQueueLength.increment();
                 }
                 lock.notifyAll();
                 if (SpecialReferenceManager.specialReferenceLogger.enabled()) {
@@ -143,6 +145,7 @@ public final class JDK_java_lang_ref_ReferenceQueue {
             queueLength--;
             if (ClassRegistry.JLR_FINAL_REFERENCE.isInstance(r)) {
                 sun.misc.VM.addFinalRefCount(-1);
+                SpecialReferenceManager.finalizerQueueLength.add(-1L);
             }
             if (SpecialReferenceManager.specialReferenceLogger.enabled()) {
                 SpecialReferenceManager.specialReferenceLogger.logRemove(
@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package com.sun.max.vm.jdk;
+
+import com.sun.max.annotate.*;
+import com.sun.max.vm.runtime.*;
+
+/**
+ * Method substitutions for sun.management.OperatingSystemImpl, which make the
+ * {@link java.lang.management.OperatingSystemMXBean} report the resources granted to the VM process.
+ */
+@METHOD_SUBSTITUTIONS(className = "sun.management.OperatingSystemImpl")
+final class JDK_sun_management_OperatingSystemImpl {
+
+    @SUBSTITUTE
+    public long getProcessCpuTime() {
+        return OSResources.processCpuTime();
+    }
+
+    /**
+     * Gets the physical memory of the platform capped by the memory limit of the container the VM runs in.
+     */
+    @SUBSTITUTE
+    public long getTotalPhysicalMemorySize() {
+        return OSResources.availableMemory().toLong();
+    }
+}
@@ -22,17 +22,21 @@
  */
 package com.sun.max.vm.jdk;
 
+import static com.sun.max.vm.management.PerfMemory.*;
+
+import java.io.*;
 import java.nio.*;
 import java.util.*;
 
 import sun.misc.*;
+import sun.nio.ch.DirectBuffer;
 
 import com.sun.max.annotate.*;
+import com.sun.max.lang.*;
 import com.sun.max.memory.*;
 import com.sun.max.unsafe.*;
-import com.sun.max.vm.*;
+import com.sun.max.vm.management.*;
 import com.sun.max.vm.object.*;
-import com.sun.max.vm.runtime.*;
 
 /**
  * Method sustitutions for the {@link sun.misc.Perf} class.
@@ -44,37 +48,11 @@ final class JDK_sun_misc_Perf {
     private JDK_sun_misc_Perf() {
     }
 
-    private static final int VARIABILITY_CONSTANT = 1;
-    private static final int VARIABILITY_MONOTONIC = 2;
-    private static final int VARIABILITY_VARIABLE = 3;
-
-    private static final int UNITS_NONE = 1;
-    private static final int UNITS_BYTES = 2;
-    private static final int UNITS_TICKS = 3;
-    private static final int UNITS_EVENTS = 4;
-    private static final int UNITS_STRING = 5;
-    private static final int UNITS_HERTZ = 6;
-
-    static class PerfData {
-        String name;
-        int units;
-        int variability;
-        PerfData(String name, int units, int variability) {
-            this.name = name;
-            this.units = units;
-            this.variability = variability;
-        }
-    }
+    private static final int PERF_MODE_RO = 0;
+    private static final int PERF_MODE_RW = 1;
 
-    static class PerfString extends PerfData {
-        Pointer address;
-        PerfString(String name, int units, int variability, Pointer address) {
-            super(name, units, variability);
-            this.address = address;
-        }
-    }
+    private static final Set<String> names = new HashSet<String>();
 
-    private static final Map<String, PerfData> perfDataMap = new HashMap<String, PerfData>();
     /**
      * Register any native methods.
      */
@@ -93,8 +71,28 @@ final class JDK_sun_misc_Perf {
      */
     @SUBSTITUTE
     private ByteBuffer attach(String user, int lvmid, int mode) throws IllegalArgumentException {
-        FatalError.unimplemented("com.sun.max.vm.jdk.JDK_sun_misc_Perf.attach");
-        return null;
+        if (mode != PERF_MODE_RO && mode != PERF_MODE_RW) {
+            throw new IllegalArgumentException("invalid mode: " + mode);
+        }
+        if (lvmid == 0 || lvmid == PerfMemory.processId()) {
+            if (PerfMemory.start().isZero()) {
+                throw new IllegalArgumentException("performance data is not available (-XX:-UsePerfData)");
+            }
+            return ObjectAccess.createDirectByteBuffer(PerfMemory.start().toLong(), PerfMemory.capacity().toInt());
+        }
+        if (mode != PERF_MODE_RO) {
+            throw new IllegalArgumentException("only read-only access to another VM is supported");
+        }
+        final String path = PerfMemory.backingStorePath(user == null ? System.getProperty("user.name") : user, lvmid);
+        final long size = new File(path).length();
+        if (size == 0L || size > Integer.MAX_VALUE) {
+            throw new IllegalArgumentException("no performance data for vmid " + lvmid);
+        }
+        final Pointer address = PerfMemory.attach(path, Size.fromLong(size));
+        if (address.isZero()) {
+            throw new IllegalArgumentException("could not map the performance data of vmid " + lvmid);
+        }
+        return ObjectAccess.createDirectByteBuffer(address.toLong(), (int) size);
     }
 
     /**
@@ -104,7 +102,10 @@ final class JDK_sun_misc_Perf {
      */
     @SUBSTITUTE
     private void detach(ByteBuffer byteBuffer) {
-        FatalError.unimplemented("com.sun.max.vm.jdk.JDK_sun_misc_Perf.detach");
+        final Pointer address = Pointer.fromLong(((DirectBuffer) byteBuffer).address());
+        if (!address.equals(PerfMemory.start())) {
+            PerfMemory.detach(address, Size.fromInt(byteBuffer.capacity()));
+        }
     }
 
     /**
@@ -118,8 +119,27 @@ final class JDK_sun_misc_Perf {
      */
     @SUBSTITUTE
     public ByteBuffer createLong(String name, int variability, int units, long value) {
-        FatalError.unimplemented("com.sun.max.vm.jdk.JDK_sun_misc_Perf.createLong");
-        return null;
+        if (name == null) {
+            throw new NullPointerException();
+        }
+        if (variability < VARIABILITY_CONSTANT || variability > VARIABILITY_VARIABLE) {
+            throw new IllegalArgumentException("invalid variability: " + variability);
+        }
+        if (units < UNITS_NONE || units > UNITS_HERTZ || units == UNITS_STRING) {
+            throw new IllegalArgumentException("invalid units: " + units);
+        }
+        checkNewName(name);
+        final Pointer address = PerfMemory.allocateEntry(name, 'J', variability, units, 0, Longs.SIZE);
+        address.writeLong(0, value);
+        return ObjectAccess.createDirectByteBuffer(address.toLong(), Longs.SIZE);
+    }
+
+    private static void checkNewName(String name) {
+        synchronized (names) {
+            if (!names.add(name)) {
+                throw new IllegalArgumentException("name: " + name + " already exists");
+            }
+        }
     }
 
     /**
@@ -142,15 +162,9 @@ final class JDK_sun_misc_Perf {
         if (units != UNITS_STRING) {
             throw new IllegalArgumentException("invalid units: " + units);
         }
-        PerfData perfData = perfDataMap.get(name);
-        if (perfData != null) {
-            throw new IllegalArgumentException("name: " + name + " already exists");
-        }
-
-        final Pointer address = Memory.mustAllocate(maxLength);
-        Memory.writeBytes(value, address);
-        final PerfString perfString = new PerfString(name, variability, units, address);
-        perfDataMap.put(name, perfString);
+        checkNewName(name);
+        final Pointer address = PerfMemory.allocateEntry(name, 'B', variability, units, maxLength, 1);
+        Memory.writeBytes(value, Math.min(value.length, maxLength), address);
         return ObjectAccess.createDirectByteBuffer(address.toLong(), maxLength);
     }
 
@@ -161,7 +175,7 @@ final class JDK_sun_misc_Perf {
      */
     @SUBSTITUTE
     public long highResCounter() {
-        return System.nanoTime() - MaxineVM.getStartupTimeNano();
+        return PerfMemory.ticks();
     }
 
     /**
@@ -128,11 +128,12 @@ final class JDK_sun_misc_Unsafe {
         Reference.fromJava(object).writeReference(Offset.fromLong(offset), Reference.fromJava(value));
     }
 
-    //TODO (ck): Implement the native part of the function
     @SUBSTITUTE
     public int getLoadAverage(double[] loadavg, int nelems) {
-        ProgramWarning.message("sun.misc.Unsafe.getLoadAverage not implemented in Maxine VM, it always returns -1");
-        return -1;
+        if (nelems < 0 || nelems > 3 || nelems > loadavg.length) {
+            throw new ArrayIndexOutOfBoundsException();
+        }
+        return OSResources.loadAverage(loadavg, nelems);
     }
 
     /**
@@ -532,7 +533,8 @@ final class JDK_sun_misc_Unsafe {
         if (bytes < 0L || bytes > Word.widthValue().max) {
             throw new IllegalArgumentException();
         }
-        Pointer address = Memory.allocate(Size.fromLong(bytes));
+        // Unsafe memory is not guaranteed to be zeroed
+        Pointer address = Memory.allocate(Size.fromLong(bytes), Memory.Category.UNSAFE, false);
         if (address.isZero()) {
             throw new OutOfMemoryError();
         }
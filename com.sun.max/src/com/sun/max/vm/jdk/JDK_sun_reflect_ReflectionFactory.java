@@ -105,9 +105,18 @@ public final class JDK_sun_reflect_ReflectionFactory {
      */
     @SUBSTITUTE
     public MethodAccessor newMethodAccessor(Method method) {
-        MethodAccessor result = prePopulatedMethodStubs.get(MethodActor.fromJava(method));
+        return methodAccessorFor(MethodActor.fromJava(method));
+    }
+
+    /**
+     * Gets the accessor shared by all the {@link Method} objects reflecting a given method.
+     * @param methodActor the method for which to get the accessor
+     * @return the pre-populated stub for {@code methodActor} if there is one, otherwise its reflection stub
+     */
+    public static MethodAccessor methodAccessorFor(MethodActor methodActor) {
+        MethodAccessor result = prePopulatedMethodStubs.get(methodActor);
         if (result == null) {
-            result = newMethodStub(method, Boxing.JAVA);
+            result = (MethodAccessor) methodActor.makeReflectionStub();
         }
         return result;
     }
@@ -120,7 +129,8 @@ public final class JDK_sun_reflect_ReflectionFactory {
      */
     @SUBSTITUTE
     public ConstructorAccessor newConstructorAccessor(Constructor constructor) {
-        ConstructorAccessor result = prePopulatedConstructorStubs.get(MethodActor.fromJavaConstructor(constructor));
+        final MethodActor constructorActor = MethodActor.fromJavaConstructor(constructor);
+        ConstructorAccessor result = prePopulatedConstructorStubs.get(constructorActor);
         if (result == null) {
             final Class declaringClass = constructor.getDeclaringClass();
             if (Modifier.isAbstract(declaringClass.getModifiers())) {
@@ -137,7 +147,7 @@ public final class JDK_sun_reflect_ReflectionFactory {
                     }
                 };
             }
-            result = newConstructorStub(constructor, null, Boxing.JAVA);
+            result = (ConstructorAccessor) constructorActor.makeReflectionStub();
         }
         return result;
     }
@@ -292,7 +292,10 @@ public final class DynamicLinker {
     */
 
     static {
-        new CriticalNativeMethod(Memory.class, "memory_allocate");
+        new CriticalNativeMethod(Memory.class, "memory_allocate_category");
+        new CriticalNativeMethod(Memory.class, "memory_set");
+        new CriticalNativeMethod(Memory.class, "memory_compare");
+        new CriticalNativeMethod(Memory.class, "memory_copy");
     }
 
     /**
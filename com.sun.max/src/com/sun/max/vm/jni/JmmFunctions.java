@@ -25,10 +25,12 @@ package com.sun.max.vm.jni;
 import static com.sun.max.vm.jni.JniFunctions.*;
 import static com.sun.max.vm.jni.JniFunctions.JxxFunctionsLogger.*;
 
+import java.io.*;
 import java.lang.management.*;
 
 import com.sun.max.annotate.*;
 import com.sun.max.unsafe.*;
+import com.sun.max.vm.heap.*;
 import com.sun.max.vm.management.*;
 import com.sun.max.vm.runtime.*;
 import com.sun.max.vm.thread.*;
@@ -152,23 +154,23 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static native void reserved1();
-        // Source: JmmFunctionsSource.java:53
+        // Source: JmmFunctionsSource.java:55
 
     @VM_ENTRY_POINT
     private static native void reserved2();
-        // Source: JmmFunctionsSource.java:56
+        // Source: JmmFunctionsSource.java:58
 
     @VM_ENTRY_POINT
     private static native int GetVersion(Pointer env);
-        // Source: JmmFunctionsSource.java:59
+        // Source: JmmFunctionsSource.java:61
 
     @VM_ENTRY_POINT
     private static native int GetOptionalSupport(Pointer env, Pointer support_ptr);
-        // Source: JmmFunctionsSource.java:62
+        // Source: JmmFunctionsSource.java:64
 
     @VM_ENTRY_POINT
     private static JniHandle GetInputArguments(Pointer env) {
-        // Source: JmmFunctionsSource.java:65
+        // Source: JmmFunctionsSource.java:67
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetInputArguments.ordinal(), UPCALL_ENTRY, anchor, env);
@@ -190,7 +192,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static int GetThreadInfo(Pointer env, JniHandle ids, int maxDepth, JniHandle infoArray) {
-        // Source: JmmFunctionsSource.java:70
+        // Source: JmmFunctionsSource.java:72
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetThreadInfo.ordinal(), UPCALL_ENTRY, anchor, env, ids, Address.fromInt(maxDepth), infoArray);
@@ -215,7 +217,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static JniHandle GetInputArgumentArray(Pointer env) {
-        // Source: JmmFunctionsSource.java:78
+        // Source: JmmFunctionsSource.java:80
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetInputArgumentArray.ordinal(), UPCALL_ENTRY, anchor, env);
@@ -237,7 +239,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static JniHandle GetMemoryPools(Pointer env, JniHandle mgr) {
-        // Source: JmmFunctionsSource.java:83
+        // Source: JmmFunctionsSource.java:85
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetMemoryPools.ordinal(), UPCALL_ENTRY, anchor, env, mgr);
@@ -261,7 +263,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static JniHandle GetMemoryManagers(Pointer env, JniHandle pool) {
-        // Source: JmmFunctionsSource.java:90
+        // Source: JmmFunctionsSource.java:92
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetMemoryManagers.ordinal(), UPCALL_ENTRY, anchor, env, pool);
@@ -285,7 +287,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static JniHandle GetMemoryPoolUsage(Pointer env, JniHandle pool) {
-        // Source: JmmFunctionsSource.java:97
+        // Source: JmmFunctionsSource.java:99
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetMemoryPoolUsage.ordinal(), UPCALL_ENTRY, anchor, env, pool);
@@ -307,7 +309,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static JniHandle GetPeakMemoryPoolUsage(Pointer env, JniHandle pool) {
-        // Source: JmmFunctionsSource.java:102
+        // Source: JmmFunctionsSource.java:104
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetPeakMemoryPoolUsage.ordinal(), UPCALL_ENTRY, anchor, env, pool);
@@ -329,11 +331,11 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static native Pointer reserved4();
-        // Source: JmmFunctionsSource.java:107
+        // Source: JmmFunctionsSource.java:109
 
     @VM_ENTRY_POINT
     private static JniHandle GetMemoryUsage(Pointer env, boolean heap) {
-        // Source: JmmFunctionsSource.java:110
+        // Source: JmmFunctionsSource.java:112
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetMemoryUsage.ordinal(), UPCALL_ENTRY, anchor, env, Address.fromInt(heap ? 1 : 0));
@@ -355,7 +357,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static long GetLongAttribute(Pointer env, JniHandle obj, int att) {
-        // Source: JmmFunctionsSource.java:115
+        // Source: JmmFunctionsSource.java:117
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetLongAttribute.ordinal(), UPCALL_ENTRY, anchor, env, obj, Address.fromInt(att));
@@ -377,7 +379,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static boolean GetBoolAttribute(Pointer env, int att) {
-        // Source: JmmFunctionsSource.java:120
+        // Source: JmmFunctionsSource.java:122
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetBoolAttribute.ordinal(), UPCALL_ENTRY, anchor, env, Address.fromInt(att));
@@ -399,7 +401,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static boolean SetBoolAttribute(Pointer env, int att, boolean flag) {
-        // Source: JmmFunctionsSource.java:125
+        // Source: JmmFunctionsSource.java:127
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.SetBoolAttribute.ordinal(), UPCALL_ENTRY, anchor, env, Address.fromInt(att), Address.fromInt(flag ? 1 : 0));
@@ -433,7 +435,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static int GetLongAttributes(Pointer env, JniHandle obj, JniHandle atts, int count, JniHandle result) {
-        // Source: JmmFunctionsSource.java:142
+        // Source: JmmFunctionsSource.java:144
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetLongAttributes.ordinal(), UPCALL_ENTRY, anchor, env, obj, atts, Address.fromInt(count), result);
@@ -455,7 +457,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static JniHandle FindCircularBlockedThreads(Pointer env) {
-        // Source: JmmFunctionsSource.java:147
+        // Source: JmmFunctionsSource.java:149
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.FindCircularBlockedThreads.ordinal(), UPCALL_ENTRY, anchor, env);
@@ -477,7 +479,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static long GetThreadCpuTime(Pointer env, long thread_id) {
-        // Source: JmmFunctionsSource.java:152
+        // Source: JmmFunctionsSource.java:154
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetThreadCpuTime.ordinal(), UPCALL_ENTRY, anchor, env, Address.fromLong(thread_id));
@@ -499,7 +501,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static JniHandle GetVMGlobalNames(Pointer env) {
-        // Source: JmmFunctionsSource.java:157
+        // Source: JmmFunctionsSource.java:159
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetVMGlobalNames.ordinal(), UPCALL_ENTRY, anchor, env);
@@ -521,7 +523,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static int GetVMGlobals(Pointer env, JniHandle names, Pointer globals, int count) {
-        // Source: JmmFunctionsSource.java:162
+        // Source: JmmFunctionsSource.java:164
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetVMGlobals.ordinal(), UPCALL_ENTRY, anchor, env, names, globals, Address.fromInt(count));
@@ -543,7 +545,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static int GetInternalThreadTimes(Pointer env, JniHandle names, JniHandle times) {
-        // Source: JmmFunctionsSource.java:167
+        // Source: JmmFunctionsSource.java:169
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetInternalThreadTimes.ordinal(), UPCALL_ENTRY, anchor, env, names, times);
@@ -565,7 +567,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static boolean ResetStatistic(Pointer env, Word obj, int type) {
-        // Source: JmmFunctionsSource.java:172
+        // Source: JmmFunctionsSource.java:174
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.ResetStatistic.ordinal(), UPCALL_ENTRY, anchor, env, obj, Address.fromInt(type));
@@ -587,7 +589,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static void SetPoolSensor(Pointer env, JniHandle pool, int type, JniHandle sensor) {
-        // Source: JmmFunctionsSource.java:177
+        // Source: JmmFunctionsSource.java:179
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.SetPoolSensor.ordinal(), UPCALL_ENTRY, anchor, env, pool, Address.fromInt(type), sensor);
@@ -607,7 +609,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static long SetPoolThreshold(Pointer env, JniHandle pool, int type, long threshold) {
-        // Source: JmmFunctionsSource.java:181
+        // Source: JmmFunctionsSource.java:183
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.SetPoolThreshold.ordinal(), UPCALL_ENTRY, anchor, env, pool, Address.fromInt(type), Address.fromLong(threshold));
@@ -629,7 +631,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static JniHandle GetPoolCollectionUsage(Pointer env, JniHandle pool) {
-        // Source: JmmFunctionsSource.java:186
+        // Source: JmmFunctionsSource.java:188
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetPoolCollectionUsage.ordinal(), UPCALL_ENTRY, anchor, env, pool);
@@ -651,7 +653,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static int GetGCExtAttributeInfo(Pointer env, JniHandle mgr, Pointer ext_info, int count) {
-        // Source: JmmFunctionsSource.java:191
+        // Source: JmmFunctionsSource.java:193
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetGCExtAttributeInfo.ordinal(), UPCALL_ENTRY, anchor, env, mgr, ext_info, Address.fromInt(count));
@@ -673,7 +675,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static void GetLastGCStat(Pointer env, JniHandle mgr, Pointer gc_stat) {
-        // Source: JmmFunctionsSource.java:196
+        // Source: JmmFunctionsSource.java:198
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetLastGCStat.ordinal(), UPCALL_ENTRY, anchor, env, mgr, gc_stat);
@@ -693,7 +695,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static long GetThreadCpuTimeWithKind(Pointer env, long thread_id, boolean user_sys_cpu_time) {
-        // Source: JmmFunctionsSource.java:200
+        // Source: JmmFunctionsSource.java:202
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.GetThreadCpuTimeWithKind.ordinal(), UPCALL_ENTRY, anchor, env, Address.fromLong(thread_id), Address.fromInt(user_sys_cpu_time ? 1 : 0));
@@ -715,18 +717,18 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static native Pointer reserved5();
-        // Source: JmmFunctionsSource.java:205
+        // Source: JmmFunctionsSource.java:207
 
     @VM_ENTRY_POINT
-    private static int DumpHeap0(Pointer env, JniHandle outputfile, boolean live) {
-        // Source: JmmFunctionsSource.java:208
+    private static int DumpHeap0(Pointer env, JniHandle outputfile, boolean live) throws IOException {
+        // Source: JmmFunctionsSource.java:210
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.DumpHeap0.ordinal(), UPCALL_ENTRY, anchor, env, outputfile, Address.fromInt(live ? 1 : 0));
         }
 
         try {
-            return 0;
+            return HeapDump.dump((String) outputfile.unhand(), live);
         } catch (Throwable t) {
             VmThread.fromJniEnv(env).setJniException(t);
             return JNI_ERR;
@@ -741,7 +743,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static JniHandle FindDeadlocks(Pointer env, boolean object_monitors_only) {
-        // Source: JmmFunctionsSource.java:213
+        // Source: JmmFunctionsSource.java:215
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.FindDeadlocks.ordinal(), UPCALL_ENTRY, anchor, env, Address.fromInt(object_monitors_only ? 1 : 0));
@@ -763,7 +765,7 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static void SetVMGlobal(Pointer env, JniHandle flag_name, Word new_value) {
-        // Source: JmmFunctionsSource.java:218
+        // Source: JmmFunctionsSource.java:220
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.SetVMGlobal.ordinal(), UPCALL_ENTRY, anchor, env, flag_name, new_value);
@@ -783,11 +785,11 @@ public final class JmmFunctions {
 
     @VM_ENTRY_POINT
     private static native Word reserved6();
-        // Source: JmmFunctionsSource.java:222
+        // Source: JmmFunctionsSource.java:224
 
     @VM_ENTRY_POINT
     private static JniHandle DumpThreads(Pointer env, JniHandle ids, boolean lockedMonitors, boolean lockedSynchronizers) {
-        // Source: JmmFunctionsSource.java:225
+        // Source: JmmFunctionsSource.java:227
         Pointer anchor = prologue(env);
         if (logger.enabled()) {
             logger.log(LogOperations.DumpThreads.ordinal(), UPCALL_ENTRY, anchor, env, ids, Address.fromInt(lockedMonitors ? 1 : 0), Address.fromInt(lockedSynchronizers ? 1 : 0));
@@ -24,10 +24,12 @@ package com.sun.max.vm.jni;
 
 import static com.sun.max.vm.jni.JmmFunctions.*;
 
+import java.io.*;
 import java.lang.management.*;
 
 import com.sun.max.annotate.*;
 import com.sun.max.unsafe.*;
+import com.sun.max.vm.heap.*;
 import com.sun.max.vm.management.*;
 import com.sun.max.vm.runtime.*;
 
@@ -205,8 +207,8 @@ public final class JmmFunctionsSource {
     private static native Pointer reserved5();
 
     @VM_ENTRY_POINT
-    private static int DumpHeap0(Pointer env, JniHandle outputfile, boolean live) {
-        return 0;
+    private static int DumpHeap0(Pointer env, JniHandle outputfile, boolean live) throws IOException {
+        return HeapDump.dump((String) outputfile.unhand(), live);
     }
 
     @VM_ENTRY_POINT
@@ -3489,7 +3489,7 @@ public final class JniFunctions {
     private static Pointer getBooleanArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final boolean[] a = (boolean[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setBoolean(i, a[i]);
         }
@@ -3521,7 +3521,7 @@ public final class JniFunctions {
     private static Pointer getByteArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final byte[] a = (byte[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.BYTE.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.BYTE.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setByte(i, a[i]);
         }
@@ -3553,7 +3553,7 @@ public final class JniFunctions {
     private static Pointer getCharArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final char[] a = (char[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.CHAR.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.CHAR.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setChar(i, a[i]);
         }
@@ -3585,7 +3585,7 @@ public final class JniFunctions {
     private static Pointer getShortArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final short[] a = (short[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.SHORT.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.SHORT.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setShort(i, a[i]);
         }
@@ -3617,7 +3617,7 @@ public final class JniFunctions {
     private static Pointer getIntArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final int[] a = (int[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.INT.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.INT.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setInt(i, a[i]);
         }
@@ -3649,7 +3649,7 @@ public final class JniFunctions {
     private static Pointer getLongArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final long[] a = (long[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.LONG.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.LONG.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setLong(i, a[i]);
         }
@@ -3681,7 +3681,7 @@ public final class JniFunctions {
     private static Pointer getFloatArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final float[] a = (float[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.FLOAT.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.FLOAT.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setFloat(i, a[i]);
         }
@@ -3713,7 +3713,7 @@ public final class JniFunctions {
     private static Pointer getDoubleArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final double[] a = (double[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.DOUBLE.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.DOUBLE.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setDouble(i, a[i]);
         }
@@ -4656,7 +4656,7 @@ public final class JniFunctions {
     }
 
     private static Pointer copyString(String string) {
-        final Pointer pointer = Memory.mustAllocate(string.length() * Kind.CHAR.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(string.length() * Kind.CHAR.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < string.length(); i++) {
             pointer.setChar(i, string.charAt(i));
         }
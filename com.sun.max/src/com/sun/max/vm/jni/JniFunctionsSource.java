@@ -1203,7 +1203,7 @@ public final class JniFunctionsSource {
     private static Pointer getBooleanArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final boolean[] a = (boolean[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setBoolean(i, a[i]);
         }
@@ -1218,7 +1218,7 @@ public final class JniFunctionsSource {
     private static Pointer getByteArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final byte[] a = (byte[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.BYTE.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.BYTE.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setByte(i, a[i]);
         }
@@ -1233,7 +1233,7 @@ public final class JniFunctionsSource {
     private static Pointer getCharArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final char[] a = (char[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.CHAR.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.CHAR.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setChar(i, a[i]);
         }
@@ -1248,7 +1248,7 @@ public final class JniFunctionsSource {
     private static Pointer getShortArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final short[] a = (short[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.SHORT.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.SHORT.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setShort(i, a[i]);
         }
@@ -1263,7 +1263,7 @@ public final class JniFunctionsSource {
     private static Pointer getIntArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final int[] a = (int[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.INT.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.INT.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setInt(i, a[i]);
         }
@@ -1278,7 +1278,7 @@ public final class JniFunctionsSource {
     private static Pointer getLongArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final long[] a = (long[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.LONG.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.LONG.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setLong(i, a[i]);
         }
@@ -1293,7 +1293,7 @@ public final class JniFunctionsSource {
     private static Pointer getFloatArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final float[] a = (float[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.FLOAT.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.FLOAT.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setFloat(i, a[i]);
         }
@@ -1308,7 +1308,7 @@ public final class JniFunctionsSource {
     private static Pointer getDoubleArrayElements(JniHandle array, Pointer isCopy) throws OutOfMemoryError {
         setCopyPointer(isCopy, true);
         final double[] a = (double[]) array.unhand();
-        final Pointer pointer = Memory.mustAllocate(a.length * Kind.DOUBLE.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(a.length * Kind.DOUBLE.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < a.length; i++) {
             pointer.setDouble(i, a[i]);
         }
@@ -1716,7 +1716,7 @@ public final class JniFunctionsSource {
     }
 
     private static Pointer copyString(String string) {
-        final Pointer pointer = Memory.mustAllocate(string.length() * Kind.CHAR.width.numberOfBytes);
+        final Pointer pointer = Memory.mustAllocate(Size.fromInt(string.length() * Kind.CHAR.width.numberOfBytes), Memory.Category.JNI, false);
         for (int i = 0; i < string.length(); i++) {
             pointer.setChar(i, string.charAt(i));
         }
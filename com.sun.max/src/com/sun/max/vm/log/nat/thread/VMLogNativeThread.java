@@ -118,7 +118,7 @@ public abstract class VMLogNativeThread extends VMLogNative {
 
     @NEVER_INLINE
     private Pointer allocateBuffer() {
-        Pointer buffer = Memory.allocate(Size.fromInt(logSize));
+        Pointer buffer = Memory.allocate(Size.fromInt(logSize), Memory.Category.LOGGING, true);
         vmLogBufferTL.store3(buffer);
         return buffer;
     }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package com.sun.max.vm.management;
+
+import com.sun.max.annotate.*;
+import com.sun.max.unsafe.*;
+
+/**
+ * A 64-bit counter published in the {@linkplain PerfMemory performance data region}.
+ * <p>
+ * Counters are usually created while building the boot image and are given their storage when the region
+ * is created at VM startup; until then, and when {@code -XX:-UsePerfData} is given, updates are dropped.
+ * Updates are lock-free and never allocate, so counters can be updated from GC and safepoint code.
+ */
+public final class PerfLong {
+
+    final String name;
+    final int variability;
+    final int units;
+
+    /**
+     * The location of the counter's value, or zero if it has no storage yet.
+     */
+    private Pointer address = Pointer.zero();
+
+    PerfLong(String name, int variability, int units) {
+        this.name = name;
+        this.variability = variability;
+        this.units = units;
+    }
+
+    void setAddress(Pointer address) {
+        this.address = address;
+    }
+
+    public String name() {
+        return name;
+    }
+
+    @INLINE
+    public long get() {
+        final Pointer a = address;
+        return a.isZero() ? 0L : a.readLong(0);
+    }
+
+    @INLINE
+    public void set(long value) {
+        final Pointer a = address;
+        if (!a.isZero()) {
+            a.writeLong(0, value);
+        }
+    }
+
+    @INLINE
+    public void increment() {
+        add(1L);
+    }
+
+    /**
+     * Atomically adds {@code delta} to the counter.
+     */
+    @INLINE
+    public void add(long delta) {
+        final Pointer a = address;
+        if (!a.isZero()) {
+            long value;
+            do {
+                value = a.readLong(0);
+            } while (a.compareAndSwapLong(0, value, value + delta) != value);
+        }
+    }
+}
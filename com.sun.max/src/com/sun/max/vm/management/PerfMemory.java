@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package com.sun.max.vm.management;
+
+import java.io.*;
+import java.util.*;
+
+import com.oracle.max.cri.intrinsics.*;
+import com.sun.max.lang.*;
+import com.sun.max.memory.*;
+import com.sun.max.platform.*;
+import com.sun.max.unsafe.*;
+import com.sun.max.util.*;
+import com.sun.max.vm.*;
+
+/**
+ * The performance data region read by jvmstat based tools such as {@code jstat} and {@code jps}.
+ * <p>
+ * The region is a shared mapping of the file {@code <tmp>/hsperfdata_<user>/<pid>} created by the substrate, laid
+ * out in version 2.0 of the HotSpot performance data format: a prologue followed by self-describing entries, each a
+ * name and a {@code long} value or a byte array. Tools map the file and read the values without attaching to the VM.
+ * Entries are only ever appended, and an entry is completely written before the prologue is updated to include it.
+ * <p>
+ * The VM publishes its own counters as {@link PerfLong}s, and the {@code sun.misc.Perf} substitutions allocate
+ * the entries created by the JDK here too. If the file cannot be created the region is allocated from the C heap so
+ * that the counters still work for in-process readers.
+ */
+public final class PerfMemory {
+
+    public static final int VARIABILITY_CONSTANT = 1;
+    public static final int VARIABILITY_MONOTONIC = 2;
+    public static final int VARIABILITY_VARIABLE = 3;
+
+    public static final int UNITS_NONE = 1;
+    public static final int UNITS_BYTES = 2;
+    public static final int UNITS_TICKS = 3;
+    public static final int UNITS_EVENTS = 4;
+    public static final int UNITS_STRING = 5;
+    public static final int UNITS_HERTZ = 6;
+
+    public static boolean UsePerfData = true;
+    static {
+        VMOptions.addFieldOption("-XX:", "UsePerfData", PerfMemory.class,
+            "Publish VM counters in a performance data file readable by jvmstat based tools.", MaxineVM.Phase.PRISTINE);
+    }
+
+    private static final VMSizeOption perfDataMemorySizeOption = VMOptions.register(new VMSizeOption("-XX:PerfDataMemorySize=", Size.K.times(64),
+        "The size of the performance data region."), MaxineVM.Phase.PRISTINE);
+
+    // Layout of the prologue
+    private static final int MAGIC_OFFSET = 0;
+    private static final int BYTE_ORDER_OFFSET = 4;
+    private static final int MAJOR_VERSION_OFFSET = 5;
+    private static final int MINOR_VERSION_OFFSET = 6;
+    private static final int ACCESSIBLE_OFFSET = 7;
+    private static final int USED_OFFSET = 8;
+    private static final int OVERFLOW_OFFSET = 12;
+    private static final int MOD_TIME_STAMP_OFFSET = 16;
+    private static final int ENTRY_OFFSET_OFFSET = 24;
+    private static final int NUM_ENTRIES_OFFSET = 28;
+    private static final int PROLOGUE_SIZE = 32;
+
+    // Layout of an entry header
+    private static final int ENTRY_LENGTH_OFFSET = 0;
+    private static final int NAME_OFFSET_OFFSET = 4;
+    private static final int VECTOR_LENGTH_OFFSET = 8;
+    private static final int DATA_TYPE_OFFSET = 12;
+    private static final int FLAGS_OFFSET = 13;
+    private static final int DATA_UNITS_OFFSET = 14;
+    private static final int DATA_VARIABILITY_OFFSET = 15;
+    private static final int DATA_OFFSET_OFFSET = 16;
+    private static final int ENTRY_HEADER_SIZE = 20;
+
+    /**
+     * Flag marking an entry as a supported, documented interface.
+     */
+    private static final int FLAG_SUPPORTED = 1;
+
+    /**
+     * The counters created before the region exists, which are given storage by {@link #initialize()}.
+     */
+    private static final List<PerfLong> pendingCounters = new ArrayList<PerfLong>();
+
+    private static Pointer start = Pointer.zero();
+    private static Size capacity = Size.zero();
+    private static boolean shared;
+    private static int used;
+    private static int numEntries;
+
+    private PerfMemory() {
+    }
+
+    /**
+     * Creates a counter with a given name, as listed by {@code jstat -J-Djstat.showUnsupported=true -snap}.
+     * By convention, names starting with {@code java.} or {@code com.sun.} denote supported counters.
+     */
+    public static PerfLong createLong(String name, int variability, int units) {
+        final PerfLong counter = new PerfLong(name, variability, units);
+        synchronized (pendingCounters) {
+            if (start.isZero()) {
+                pendingCounters.add(counter);
+                return counter;
+            }
+        }
+        counter.setAddress(allocateEntry(name, 'J', variability, units, 0, Longs.SIZE));
+        return counter;
+    }
+
+    /**
+     * Creates the region and publishes the counters created so far.
+     */
+    public static void initialize() {
+        if (!UsePerfData || !start.isZero()) {
+            return;
+        }
+        final Size size = perfDataMemorySizeOption.getValue().alignUp(Platform.platform().pageSize);
+        Pointer region = Pointer.fromLong(nativeCreate(size.toLong()));
+        shared = !region.isZero();
+        if (!shared) {
+            Log.println("Warning: could not create the performance data file, using non-shared memory");
+            // The data of the counters must start out as zero
+            region = Memory.allocate(size, Memory.Category.OTHER, true);
+            if (region.isZero()) {
+                return;
+            }
+        }
+        region.writeByte(MAGIC_OFFSET, (byte) 0xca);
+        region.writeByte(MAGIC_OFFSET + 1, (byte) 0xfe);
+        region.writeByte(MAGIC_OFFSET + 2, (byte) 0xc0);
+        region.writeByte(MAGIC_OFFSET + 3, (byte) 0xc0);
+        region.writeByte(BYTE_ORDER_OFFSET, (byte) (Platform.platform().endianness() == Endianness.LITTLE ? 1 : 0));
+        region.writeByte(MAJOR_VERSION_OFFSET, (byte) 2);
+        region.writeByte(MINOR_VERSION_OFFSET, (byte) 0);
+        region.writeInt(USED_OFFSET, PROLOGUE_SIZE);
+        region.writeInt(OVERFLOW_OFFSET, 0);
+        region.writeLong(MOD_TIME_STAMP_OFFSET, ticks());
+        region.writeInt(ENTRY_OFFSET_OFFSET, PROLOGUE_SIZE);
+        region.writeInt(NUM_ENTRIES_OFFSET, 0);
+        used = PROLOGUE_SIZE;
+        capacity = size;
+
+        final PerfLong[] counters;
+        synchronized (pendingCounters) {
+            start = region;
+            counters = pendingCounters.toArray(new PerfLong[pendingCounters.size()]);
+            pendingCounters.clear();
+        }
+        for (PerfLong counter : counters) {
+            counter.setAddress(allocateEntry(counter.name, 'J', counter.variability, counter.units, 0, Longs.SIZE));
+        }
+        createLong("sun.os.hrt.frequency", VARIABILITY_CONSTANT, UNITS_HERTZ).set(1000000000L);
+        createLong("sun.rt.createVmBeginTime", VARIABILITY_CONSTANT, UNITS_NONE).set(MaxineVM.getStartupTime());
+        start.writeByte(ACCESSIBLE_OFFSET, (byte) 1);
+    }
+
+    /**
+     * Removes the performance data file at VM exit. The region stays mapped: other threads are not stopped
+     * before the VM exits, and they, the {@link PerfLong} counters and the JDK's {@code Perf} buffers may
+     * still write to it.
+     */
+    public static void destroy() {
+        if (shared) {
+            shared = false;
+            nativeRemoveBackingStore();
+        }
+    }
+
+    /**
+     * Gets the current value of the high resolution counter used for time stamps, in nanoseconds since VM startup.
+     */
+    public static long ticks() {
+        return System.nanoTime() - MaxineVM.getStartupTimeNano();
+    }
+
+    public static Pointer start() {
+        return start;
+    }
+
+    public static Size capacity() {
+        return capacity;
+    }
+
+    /**
+     * Allocates and publishes an entry. If the region does not exist or is full, the data is allocated from
+     * the C heap instead; the region's overflow field records how much space would have been needed.
+     *
+     * @param dataType {@code 'J'} for {@code long} data or {@code 'B'} for {@code byte} data
+     * @param vectorLength 0 for a scalar or the number of elements of a vector
+     * @param elementSize the size in bytes of the scalar or of a vector element
+     * @return the address of the entry's data
+     */
+    public static synchronized Pointer allocateEntry(String name, char dataType, int variability, int units, int vectorLength, int elementSize) {
+        final byte[] nameBytes = Utf8.stringToUtf8(name);
+        final int dataLength = vectorLength == 0 ? elementSize : elementSize * vectorLength;
+        int size = ENTRY_HEADER_SIZE + nameBytes.length + 1;
+        if (size % elementSize != 0) {
+            size += elementSize - size % elementSize;
+        }
+        final int dataOffset = size;
+        size = (size + dataLength + Longs.SIZE - 1) & ~(Longs.SIZE - 1);
+
+        if (start.isZero() || used + size > capacity.toInt()) {
+            if (!start.isZero()) {
+                start.writeInt(OVERFLOW_OFFSET, start.readInt(OVERFLOW_OFFSET) + size);
+            }
+            return Memory.mustAllocate(Size.fromInt(dataLength), Memory.Category.OTHER, true);
+        }
+
+        final Pointer entry = start.plus(used);
+        entry.writeInt(ENTRY_LENGTH_OFFSET, size);
+        entry.writeInt(NAME_OFFSET_OFFSET, ENTRY_HEADER_SIZE);
+        entry.writeInt(VECTOR_LENGTH_OFFSET, vectorLength);
+        entry.writeByte(DATA_TYPE_OFFSET, (byte) dataType);
+        entry.writeByte(FLAGS_OFFSET, (byte) (name.startsWith("java.") || name.startsWith("com.sun.") ? FLAG_SUPPORTED : 0));
+        entry.writeByte(DATA_UNITS_OFFSET, (byte) units);
+        entry.writeByte(DATA_VARIABILITY_OFFSET, (byte) variability);
+        entry.writeInt(DATA_OFFSET_OFFSET, dataOffset);
+        Memory.writeBytes(nameBytes, entry.plus(ENTRY_HEADER_SIZE));
+        entry.writeByte(ENTRY_HEADER_SIZE + nameBytes.length, (byte) 0);
+
+        // Readers take the entry count from the prologue, so the entry must be visible first
+        used += size;
+        MemoryBarriers.barrier(MemoryBarriers.STORE_STORE);
+        start.writeInt(USED_OFFSET, used);
+        start.writeInt(NUM_ENTRIES_OFFSET, ++numEntries);
+        start.writeLong(MOD_TIME_STAMP_OFFSET, ticks());
+        return entry.plus(dataOffset);
+    }
+
+    public static int processId() {
+        return nativeProcessId();
+    }
+
+    /**
+     * Gets the path of the performance data file of the VM with process id {@code lvmid} run by {@code user}.
+     */
+    public static String backingStorePath(String user, int lvmid) {
+        return nativeTemporaryDirectory() + File.separator + "hsperfdata_" + user + File.separator + lvmid;
+    }
+
+    /**
+     * Maps the performance data file of another VM read-only.
+     *
+     * @return the address of the mapping or zero if the file could not be mapped
+     */
+    public static Pointer attach(String path, Size size) {
+        return Pointer.fromLong(nativeAttach(path, size.toLong()));
+    }
+
+    public static void detach(Pointer address, Size size) {
+        nativeDetach(address.toLong(), size.toLong());
+    }
+
+    /* These are JNI functions because they may block */
+
+    private static native long nativeCreate(long size);
+
+    private static native void nativeRemoveBackingStore();
+
+    private static native int nativeProcessId();
+
+    private static native String nativeTemporaryDirectory();
+
+    private static native long nativeAttach(String path, long size);
+
+    private static native void nativeDetach(long address, long size);
+}
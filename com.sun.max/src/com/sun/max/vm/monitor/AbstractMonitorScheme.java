@@ -24,6 +24,7 @@ import com.sun.max.annotate.*;
 import com.sun.max.vm.*;
 import com.sun.max.vm.reference.*;
 import com.sun.max.vm.runtime.*;
+import com.sun.max.vm.thread.*;
 
 /**
  * Common operations for all {@link MonitorScheme} implementations.
@@ -61,11 +62,20 @@ public abstract class AbstractMonitorScheme extends AbstractVMScheme implements
             return System.identityHashCode(object);
         }
 
-        int hashCode = Reference.fromJava(object).toOrigin().unsignedShiftedRight(3).toInt() ^ counter++;
+        final VmThread thread = VmThread.current();
+        int hashCode;
+        if (thread != null) {
+            hashCode = thread.nextHashCode();
+        } else {
+            // Too early in thread attachment for a per-thread generator
+            hashCode = Reference.fromJava(object).toOrigin().unsignedShiftedRight(3).toInt() ^ counter++;
+        }
         // Ensure the hash code is positive. Even though the specification does not require this, at
         // least one application (NetBeans) assumes this is the case (see
         // https://netbeans.org/bugzilla/show_bug.cgi?id=178688).
-        return hashCode & ~0x80000000;
+        hashCode &= ~0x80000000;
+        // Zero denotes an absent hash code in the lockword
+        return hashCode == 0 ? 1 : hashCode;
     }
 
 }
@@ -20,6 +20,7 @@
  */
 package com.sun.max.vm.monitor.modal.modehandlers.lightweight.biased;
 
+import com.sun.max.annotate.*;
 import com.sun.max.unsafe.*;
 import com.sun.max.vm.*;
 import com.sun.max.vm.actor.holder.*;
@@ -57,6 +58,19 @@ public abstract class BiasedLockModeHandler extends AbstractModeHandler implemen
     // owner, or do we assume that it is by implication of block-structured locking?
     private static final boolean ASSUME_PERFECT_ENTRY_AND_EXIT_PAIRS = false;
 
+    /**
+     * Determines if an identity hash code is installed in the lockword when an object is first biased.
+     * Only the bias owner may write the hash code field of a biased lockword, so a thread asking for
+     * the hash code of an object biased to another thread would otherwise have to revoke the bias.
+     * This is off by default, as it makes every first bias pay for generating a hash code that most
+     * objects never need; enable it for workloads that hash many objects shared between threads.
+     */
+    public static boolean HashOnBias;
+
+    static {
+        VMOptions.addFieldOption("-XX:", "HashOnBias", BiasedLockModeHandler.class, "Install identity hash codes when objects are biased, avoiding revocation for hashing.");
+    }
+
     public static MonitorSchemeEntry asFastPath(boolean useBulkRevocation, ModeDelegate delegate) {
         if (useBulkRevocation) {
             return new BiasedLockModeHandler.FastPathWithEpoch(delegate);
@@ -72,6 +86,18 @@ public abstract class BiasedLockModeHandler extends AbstractModeHandler implemen
     public void initialize(MaxineVM.Phase phase) {
     }
 
+    /**
+     * Installs a new hash code into a copy of a lockword that is about to be published with a bias owner,
+     * unless the lockword already holds one.
+     */
+    @INLINE
+    protected final BiasedLockword withHashcode(Object object, BiasedLockword biasedLockword) {
+        if (HashOnBias && biasedLockword.getHashcode() == 0) {
+            return BiasedLockword.from(biasedLockword.setHashcode(monitorScheme().createHashCode(object)));
+        }
+        return biasedLockword;
+    }
+
     // Inspector support
     public static int decodeBiasOwnerThreadID(BiasedLockword biasedLockword) {
         if (biasedLockword.equals(biasedLockword.asAnonBiased())) {
@@ -262,7 +288,7 @@ public abstract class BiasedLockModeHandler extends AbstractModeHandler implemen
                 // Is the lock unbiased and biasable?
                 if (biasedLockword.equals(biasedLockword.asAnonBiased())) {
                     // Try to get the bias
-                    final BiasedLockword newBiasedLockword = biasedLockword.asBiasedAndLockedOnceBy(lockwordThreadID);
+                    final BiasedLockword newBiasedLockword = withHashcode(object, biasedLockword.asBiasedAndLockedOnceBy(lockwordThreadID));
                     currentLockword = ModalLockword.from(ObjectAccess.compareAndSwapMisc(object, biasedLockword, newBiasedLockword));
                     if (currentLockword.equals(biasedLockword)) {
                         // Current thread is now the bias owner
@@ -399,7 +425,7 @@ public abstract class BiasedLockModeHandler extends AbstractModeHandler implemen
                     return;
                 } else if (biasedLockword.equals(biasedLockword.asAnonBiased()) || !biasedLockword.getEpoch().equals(classEpoch)) {
                     // Object is not biased or it's bias is not in the current epoch. Try to get the bias.
-                    final BiasedLockword newBiasedLockword = biasedLockword.asBiasedAndLockedOnceBy(lockwordThreadID, classEpoch);
+                    final BiasedLockword newBiasedLockword = withHashcode(object, biasedLockword.asBiasedAndLockedOnceBy(lockwordThreadID, classEpoch));
                     currentLockword = ModalLockword.from(ObjectAccess.compareAndSwapMisc(object, biasedLockword, newBiasedLockword));
                     if (currentLockword.equals(biasedLockword)) {
                         // Current thread is now the bias owner
@@ -33,17 +33,20 @@ import com.sun.max.vm.actor.member.StaticMethodActor;
 import com.sun.max.vm.compiler.*;
 import com.sun.max.vm.compiler.deopt.Deoptimization;
 import com.sun.max.vm.heap.Heap;
+import com.sun.max.vm.heap.SpecialReferenceManager;
 import com.sun.max.vm.hosted.CompiledPrototype;
 import com.sun.max.vm.instrument.InstrumentationManager;
 import com.sun.max.vm.jdk.JDK_sun_launcher_LauncherHelper;
 import com.sun.max.vm.jni.JniFunctions;
 import com.sun.max.vm.log.VMLog;
+import com.sun.max.vm.management.PerfMemory;
 import com.sun.max.vm.profilers.tracing.numa.NUMAProfiler;
 import com.sun.max.vm.profilers.tracing.numa.ProfilerGCCallback;
 import com.sun.max.vm.profilers.sampling.*;
 import com.sun.max.vm.run.RunScheme;
 import com.sun.max.vm.runtime.CriticalMethod;
 import com.sun.max.vm.runtime.FatalError;
+import com.sun.max.vm.runtime.ForkSnapshot;
 import com.sun.max.vm.runtime.PrintThreads;
 import com.sun.max.vm.thread.VmThread;
 import com.sun.max.vm.ti.VMTI;
@@ -224,6 +227,7 @@ public class JavaRunScheme extends AbstractVMScheme implements RunScheme {
                 break;
             }
             case STARTING: {
+                PerfMemory.initialize();
 
                 // This hack enables (platform-dependent) tracing before the eventual System properties are set:
                 System.setProperty("line.separator", "\n");
@@ -257,6 +261,8 @@ public class JavaRunScheme extends AbstractVMScheme implements RunScheme {
                     final String heapProfOptionPrefix = hprofOption.toString();
                     heapSamplingProfiler = new HeapSamplingProfiler(heapProfOptionPrefix, heapProfOptionValue);
                 }
+                SpecialReferenceManager.initialize(MaxineVM.Phase.RUNNING);
+
                 // Initialize the NUMA Profiler
                 if (useNUMAProfiler) {
                     // Initialization is allowed only for one policy (or none).
@@ -273,6 +279,7 @@ public class JavaRunScheme extends AbstractVMScheme implements RunScheme {
             case TERMINATING: {
                 JniFunctions.printJniFunctionTimers();
                 terminateProfilers();
+                PerfMemory.destroy();
                 break;
             }
             default: {
@@ -302,6 +309,9 @@ public class JavaRunScheme extends AbstractVMScheme implements RunScheme {
             }
             // Install the signal handler for dumping threads when SIGHUP is received
             Signal.handle(new Signal("QUIT"), new PrintThreads(false));
+            if (ForkSnapshot.ForkSnapshotSignal != null) {
+                Signal.handle(new Signal(ForkSnapshot.ForkSnapshotSignal), new ForkSnapshot());
+            }
         }
     }
 
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package com.sun.max.vm.runtime;
+
+import sun.misc.*;
+
+import com.sun.max.vm.*;
+import com.sun.max.vm.MaxineVM.Phase;
+import com.sun.max.vm.heap.*;
+
+/**
+ * A VM operation that creates a stopped copy of the VM process for inspection, so that a debugger can be attached to
+ * the copy rather than to the running VM. The VM itself is only stopped for the time it takes to fork.
+ * <p>
+ * The copy is created at a safepoint, where the state of every thread other than the VM operation thread is in
+ * memory. The copy is stopped with SIGSTOP and exits when continued. On Linux, the Inspector attaches to it given
+ * its process identifier and the boot heap address logged when the snapshot is created.
+ * <p>
+ * When {@code -XX:ForkSnapshotSignal=<name>} is specified, for instance {@code USR2}, a snapshot is taken each time
+ * the VM receives that signal.
+ */
+public class ForkSnapshot extends VmOperation implements SignalHandler {
+
+    public static String ForkSnapshotSignal;
+
+    static {
+        VMOptions.addFieldOption("-XX:", "ForkSnapshotSignal", ForkSnapshot.class,
+                        "Create a stopped copy of the VM for inspection when the named signal is received", Phase.STARTING);
+    }
+
+    /**
+     * Process identifier of the last snapshot, or -1.
+     */
+    private int pid = -1;
+
+    public ForkSnapshot() {
+        super("ForkSnapshot", null, Mode.Safepoint);
+    }
+
+    @Override
+    protected void doIt() {
+        pid = MaxineVM.fork_snapshot();
+    }
+
+    /**
+     * Creates a snapshot of the VM.
+     *
+     * @return the process identifier of the snapshot, or -1 if it could not be created
+     */
+    public static int take() {
+        final ForkSnapshot operation = new ForkSnapshot();
+        operation.submit();
+        return operation.pid;
+    }
+
+    public void handle(Signal sig) {
+        submit();
+        if (pid < 0) {
+            Log.println("Could not create a snapshot of the VM");
+        } else {
+            Log.println("Created a snapshot of the VM: process " + pid + " is stopped and ready for inspection, boot heap at 0x" +
+                            Heap.bootHeapRegion.start().toHexString());
+        }
+    }
+}
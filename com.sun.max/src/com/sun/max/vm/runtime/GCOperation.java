@@ -29,6 +29,7 @@ import com.sun.max.annotate.*;
 import com.sun.max.unsafe.*;
 import com.sun.max.vm.*;
 import com.sun.max.vm.heap.*;
+import com.sun.max.vm.management.*;
 import com.sun.max.vm.monitor.*;
 import com.sun.max.vm.stack.*;
 import com.sun.max.vm.thread.*;
@@ -164,6 +165,15 @@ public abstract class GCOperation extends VmOperation {
 
     private int invocationCount;
 
+    private static final PerfLong gcInvocations = PerfMemory.createLong("sun.gc.collector.0.invocations",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_EVENTS);
+    private static final PerfLong gcTime = PerfMemory.createLong("sun.gc.collector.0.time",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_TICKS);
+    private static final PerfLong gcLastEntryTime = PerfMemory.createLong("sun.gc.collector.0.lastEntryTime",
+        PerfMemory.VARIABILITY_VARIABLE, PerfMemory.UNITS_TICKS);
+    private static final PerfLong gcLastExitTime = PerfMemory.createLong("sun.gc.collector.0.lastExitTime",
+        PerfMemory.VARIABILITY_VARIABLE, PerfMemory.UNITS_TICKS);
+
     public int invocationCount() {
         return invocationCount;
     }
@@ -192,7 +202,13 @@ public abstract class GCOperation extends VmOperation {
             Log.unlock(lockDisabledSafepoints);
         }
 
+        final long entryTime = PerfMemory.ticks();
+        gcLastEntryTime.set(entryTime);
         collect(invocationCount);
+        final long exitTime = PerfMemory.ticks();
+        gcLastExitTime.set(exitTime);
+        gcTime.add(exitTime - entryTime);
+        gcInvocations.increment();
 
         if (Heap.verbose()) {
             final long afterUsed = Heap.reportUsedSpace();
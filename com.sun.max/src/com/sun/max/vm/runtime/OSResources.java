@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026, APT Group, Department of Computer Science,
+ * School of Engineering, The University of Manchester. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ */
+package com.sun.max.vm.runtime;
+
+import com.sun.max.annotate.*;
+import com.sun.max.memory.*;
+import com.sun.max.unsafe.*;
+import com.sun.max.vm.*;
+
+/**
+ * Queries for the resources the operating system grants to the VM process. On Linux these take the
+ * CPU quota and memory limit of the process' cgroup (v1 or v2) into account, so that a VM running in
+ * a container sizes its heap and thread pools for the container rather than for the whole host.
+ * The number of processors the VM may run on is available from {@link Runtime#availableProcessors()},
+ * which accounts for the affinity mask and the CPU quota of the process.
+ */
+public final class OSResources {
+
+    private OSResources() {
+    }
+
+    /**
+     * The size of a buffer holding the 1, 5 and 15 minute load averages as C {@code double}s.
+     */
+    private static final int LOAD_AVERAGE_BUFFER_SIZE = 3 * 8;
+
+    /**
+     * Gets the memory limit of the cgroup of the VM process.
+     *
+     * @return the limit in bytes or zero if there is no limit
+     */
+    public static Size memoryLimit() {
+        return Size.fromLong(osResources_memoryLimit());
+    }
+
+    /**
+     * Gets the amount of physical memory available to the VM process, which is the physical memory of the
+     * platform capped by the {@linkplain #memoryLimit() memory limit} of the cgroup of the process.
+     */
+    public static Size availableMemory() {
+        Size physical = VirtualMemory.getPhysicalMemorySize();
+        Size limit = memoryLimit();
+        if (limit.isZero() || physical.isZero()) {
+            return physical.isZero() ? limit : physical;
+        }
+        return Size.min(physical, limit);
+    }
+
+    /**
+     * Gets the system load averages over the last 1, 5 and 15 minutes.
+     *
+     * @param loadavg the array receiving the load averages
+     * @param nelems the number of load averages to retrieve, between 1 and 3
+     * @return the number of load averages retrieved or -1 if they are not available
+     * @see sun.misc.Unsafe#getLoadAverage(double[], int)
+     */
+    public static int loadAverage(double[] loadavg, int nelems) {
+        // A single call so that all the values come from the same sample
+        Pointer buffer = Intrinsics.alloca(LOAD_AVERAGE_BUFFER_SIZE, false);
+        int n = osResources_loadAverage(buffer, nelems);
+        for (int i = 0; i < n; i++) {
+            loadavg[i] = buffer.getDouble(i);
+        }
+        return n;
+    }
+
+    /**
+     * Gets the CPU time consumed by all threads of the VM process.
+     *
+     * @return the CPU time in nanoseconds or -1 if it is not available
+     */
+    public static long processCpuTime() {
+        return osResources_processCpuTime();
+    }
+
+    @C_FUNCTION
+    private static native long osResources_memoryLimit();
+
+    @C_FUNCTION
+    private static native int osResources_loadAverage(Pointer loadavg, int nelems);
+
+    @C_FUNCTION
+    private static native long osResources_processCpuTime();
+}
@@ -30,12 +30,14 @@ import com.sun.max.unsafe.*;
 import com.sun.max.vm.*;
 import com.sun.max.vm.actor.holder.*;
 import com.sun.max.vm.actor.member.*;
+import com.sun.max.vm.heap.*;
 import com.sun.max.vm.stack.*;
 import com.sun.max.vm.thread.*;
 
 /**
  * A VM operation that dumps a stack trace to the {@linkplain Log log stream}
- * for each Java thread in the system.
+ * for each Java thread in the system. When run as a signal handler, it also
+ * prints the {@linkplain LiveClassHistogram live class histogram} if enabled.
  */
 public class PrintThreads extends VmOperation implements SignalHandler {
 
@@ -90,5 +92,6 @@ public class PrintThreads extends VmOperation implements SignalHandler {
 
     public void handle(Signal sig) {
         submit();
+        LiveClassHistogram.print();
     }
 }
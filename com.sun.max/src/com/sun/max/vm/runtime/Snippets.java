@@ -89,6 +89,12 @@ public class Snippets {
         if (!classActor.isArrayClass()) {
             throw new VerifyError("MULTIANEWARRAY cannot be applied to non-array type " + classActor);
         }
+        if (!MaxineVM.isHosted()) {
+            final Object result = Heap.createMultiArray(classActor.dynamicHub(), lengths);
+            if (result != null) {
+                return result;
+            }
+        }
         return createMultiReferenceArrayAtIndex(0, classActor, lengths);
     }
 
@@ -549,6 +555,8 @@ public class Snippets {
     @INLINE
     public static void nativeCallEpilogue0(Pointer etla, Pointer anchor) {
         blockWhileFrozen(etla);
+        // The Java frames of this thread may change from now on
+        STACK_WATERMARK.store(etla, Word.zero());
         LAST_JAVA_FRAME_ANCHOR.store(etla, anchor);
         while (SUSPEND.load(etla).equals(VmOperation.SUSPEND_REQUEST)) {
             // In particular SUSPEND_JAVA is not set, so this is a thread returning from native code
@@ -31,6 +31,7 @@ import com.sun.max.unsafe.Pointer.*;
 import com.sun.max.vm.*;
 import com.sun.max.vm.actor.holder.*;
 import com.sun.max.vm.heap.*;
+import com.sun.max.vm.management.*;
 import com.sun.max.vm.object.*;
 import com.sun.max.vm.reference.*;
 import com.sun.max.vm.stack.*;
@@ -473,6 +474,13 @@ public class VmOperation {
      */
     private static boolean atSafepoint;
 
+    private static final PerfLong safepoints = PerfMemory.createLong("sun.rt.safepoints",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_EVENTS);
+    private static final PerfLong safepointSyncTime = PerfMemory.createLong("sun.rt.safepointSyncTime",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_TICKS);
+    private static final PerfLong safepointTime = PerfMemory.createLong("sun.rt.safepointTime",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_TICKS);
+
     /**
      * Creates a VM operation.
      *
@@ -549,6 +557,7 @@ public class VmOperation {
 
                 tracePhase("-- Begin --");
 
+                final long beginTime = PerfMemory.ticks();
                 freeze();
 
                 // Ensures updates to safepoint-related control variables are visible to all threads
@@ -556,6 +565,7 @@ public class VmOperation {
                 MemoryBarriers.barrier(MemoryBarriers.STORE_LOAD);
 
                 waitUntilFrozen();
+                final long syncedTime = PerfMemory.ticks();
 
                 boolean oldAtSafepoint = atSafepoint;
                 try {
@@ -580,6 +590,12 @@ public class VmOperation {
 
                 thaw();
 
+                if (singleThread == null) {
+                    safepoints.increment();
+                    safepointSyncTime.add(syncedTime - beginTime);
+                    safepointTime.add(PerfMemory.ticks() - beginTime);
+                }
+
                 tracePhase("-- End --");
             }
 
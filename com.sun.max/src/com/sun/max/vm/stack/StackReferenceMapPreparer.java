@@ -97,6 +97,18 @@ public final class StackReferenceMapPreparer extends FrameReferenceMapVisitor {
         return Heap.logRootScanning() || (stackRootScanLogger.enabled() && LogSRSSuppressionCount <= 0);
     }
 
+    /**
+     * Determines if the stack reference map of a thread that has stayed in native code since the last
+     * GC is reused instead of being prepared again.
+     *
+     * @see VmThreadLocal#STACK_WATERMARK
+     */
+    public static boolean ReuseStackReferenceMaps = true;
+    static {
+        VMOptions.addFieldOption("-XX:", "ReuseStackReferenceMaps", StackReferenceMapPreparer.class,
+            "Reuse the stack reference map of threads that have not executed Java code since the last GC.");
+    }
+
     public static boolean VerifyRefMaps;
     static {
         VMOptions.addFieldOption("-XX:", "VerifyRefMaps", StackReferenceMapPreparer.class,
@@ -436,7 +448,16 @@ public final class StackReferenceMapPreparer extends FrameReferenceMapVisitor {
         if (instructionPointer.isZero()) {
             FatalError.unexpected("Thread is not stopped");
         }
+        if (ReuseStackReferenceMaps && !VerifyRefMaps && STACK_WATERMARK.load(etla).equals(stackPointer)) {
+            // The thread has not returned from native code since its reference map was prepared
+            // at this anchor. The frames below the anchor, and thus their reference map bits, are
+            // unchanged; only the values in the reference slots may have been updated by a GC.
+            LOWEST_ACTIVE_STACK_SLOT_ADDRESS.store3(tla, stackPointer);
+            preparationTime = 0;
+            return;
+        }
         prepareStackReferenceMap(tla, instructionPointer, stackPointer, framePointer, false);
+        STACK_WATERMARK.store(etla, stackPointer);
     }
 
     /**
@@ -31,13 +31,36 @@ import com.sun.max.vm.thread.*;
 
 /**
  * The standard stack walker used in the VM.
+ * <p>
+ * The walker keeps a small direct-mapped cache of the target methods found for recently seen
+ * instruction pointers. Deep stacks typically contain many frames of the same few methods and,
+ * since the per-thread walker is reused for every GC root scan, the same call sites are seen
+ * again and again. The cache is flushed whenever the {@linkplain Code#evictionEpoch() eviction epoch}
+ * changes and is bypassed while an eviction is in progress.
  */
 public final class VmStackFrameWalker extends StackFrameWalker {
 
+    /**
+     * Number of entries in the {@linkplain #ipCache instruction pointer cache}. Must be a power of 2.
+     */
+    private static final int IP_CACHE_SIZE = 64;
+
+    /**
+     * Low-order bits of an instruction pointer ignored when selecting a cache entry.
+     */
+    private static final int IP_CACHE_SHIFT = 4;
+
     private Pointer tla;
 
     private boolean dumpingFatalStackTrace;
 
+    private final TargetMethod[] ipCache = new TargetMethod[IP_CACHE_SIZE];
+
+    /**
+     * The eviction epoch in which the entries of {@link #ipCache} were recorded.
+     */
+    private int ipCacheEpoch;
+
     public VmStackFrameWalker(Pointer tla) {
         super();
         this.tla = tla;
@@ -49,7 +72,31 @@ public final class VmStackFrameWalker extends StackFrameWalker {
 
     @Override
     public TargetMethod targetMethodFor(Pointer instructionPointer) {
-        return Code.codePointerToTargetMethod(instructionPointer);
+        final int epoch = Code.evictionEpoch();
+        if ((epoch & 1) != 0) {
+            // code is being moved: the cached mappings cannot be trusted
+            return Code.codePointerToTargetMethod(instructionPointer);
+        }
+        if (epoch != ipCacheEpoch) {
+            flushIPCache();
+            ipCacheEpoch = epoch;
+        }
+        final int index = instructionPointer.unsignedShiftedRight(IP_CACHE_SHIFT).toInt() & (IP_CACHE_SIZE - 1);
+        TargetMethod tm = ipCache[index];
+        if (tm != null && instructionPointer.greaterEqual(tm.start()) && instructionPointer.lessThan(tm.end())) {
+            return tm;
+        }
+        tm = Code.codePointerToTargetMethod(instructionPointer);
+        if (tm != null) {
+            ipCache[index] = tm;
+        }
+        return tm;
+    }
+
+    private void flushIPCache() {
+        for (int i = 0; i < IP_CACHE_SIZE; i++) {
+            ipCache[i] = null;
+        }
     }
 
     @Override
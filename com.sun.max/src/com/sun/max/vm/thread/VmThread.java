@@ -240,6 +240,11 @@ public class VmThread {
      */
     public final int uuid;
 
+    /**
+     * State of the xorshift generator used by {@link #nextHashCode()}. Never zero.
+     */
+    private int hashState;
+
     /**
      * Denotes if this thread was started as a daemon. This property is only set once a thread
      * is about to run (for a VM created thread) or is running (for an attached thread)
@@ -672,6 +677,7 @@ public class VmThread {
             Code.initialize();
 
             vmConfig().initializeSchemes(MaxineVM.Phase.PRISTINE);
+            LiveClassHistogram.initialize(MaxineVM.Phase.PRISTINE);
 
             // We can now start the other system threads.
             VmThread.vmOperationThread.startVmSystemThread();
@@ -968,6 +974,25 @@ public class VmThread {
      */
     public VmThread() {
         uuid = nextUUid.getAndIncrement();
+        // Golden ratio spreading so that threads created in sequence start far apart in the sequence
+        hashState = (uuid * 0x9E3779B9) | 1;
+    }
+
+    /**
+     * Gets the next value from this thread's identity hash code generator. The generator is a
+     * Marsaglia xorshift sequence whose state is only accessed by the owning thread, which makes
+     * it free of the contention and lost updates of a shared counter.
+     *
+     * @return a non-zero pseudo-random value
+     */
+    @INLINE
+    public final int nextHashCode() {
+        int x = hashState;
+        x ^= x << 13;
+        x ^= x >>> 17;
+        x ^= x << 5;
+        hashState = x;
+        return x;
     }
 
     /**
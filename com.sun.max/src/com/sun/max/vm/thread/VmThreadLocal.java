@@ -305,6 +305,15 @@ public class VmThreadLocal implements FormatWithToString {
     public static final VmThreadLocal SUSPEND
         = new VmThreadLocal("SUSPEND", false, "Bitset for thread suspension", Nature.Single);
 
+    /**
+     * The stack pointer of the {@linkplain #LAST_JAVA_FRAME_ANCHOR last Java frame anchor} at which the
+     * stack reference map of a thread blocked in native code was last prepared, or zero if the map has
+     * to be prepared afresh. This is cleared by {@link Snippets#nativeCallEpilogue0} so a non-zero value
+     * means the thread has not executed any Java code since that preparation.
+     */
+    public static final VmThreadLocal STACK_WATERMARK
+        = new VmThreadLocal("STACK_WATERMARK", false, "SP of anchor at which stack reference map was last prepared", Nature.Single);
+
     /**
      * Used by {@link com.sun.max.vm.profilers.tracing.numa.NUMAProfiler} to determine the state of the profiling.
      * See {@link com.sun.max.vm.profilers.tracing.numa.NUMAProfiler.PROFILING_STATE} for the possible values it can
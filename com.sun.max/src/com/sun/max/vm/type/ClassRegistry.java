@@ -47,6 +47,7 @@ import com.sun.max.vm.compiler.deps.*;
 import com.sun.max.vm.hosted.*;
 import com.sun.max.vm.log.VMLog.*;
 import com.sun.max.vm.log.hosted.*;
+import com.sun.max.vm.management.*;
 import com.sun.max.vm.reference.*;
 import com.sun.max.vm.reflection.*;
 import com.sun.max.vm.runtime.*;
@@ -138,6 +139,9 @@ public final class ClassRegistry {
     private static int loadCount;        // total loaded
     private static int unloadCount;    // total unloaded
 
+    private static final PerfLong loadedClasses = PerfMemory.createLong("java.cls.loadedClasses",
+        PerfMemory.VARIABILITY_MONOTONIC, PerfMemory.UNITS_EVENTS);
+
     static {
         new CriticalNativeMethod(Log.class, "log_lock");
         new CriticalNativeMethod(Log.class, "log_unlock");
@@ -278,6 +282,7 @@ public final class ClassRegistry {
             return existingClassActor;
         }
         loadCount++;
+        loadedClasses.set(loadCount);
 
         // Add to class hierarchy, initialize vtables, and do possible deoptimizations.
         DependenciesManager.addToHierarchy(classActor);
@@ -381,6 +386,7 @@ public final class ClassRegistry {
         ANNOTATION_DEFAULT_BYTES(MethodActor.class, byte[].class, MethodActor.NO_ANNOTATION_DEFAULT_BYTES),
         ACCESSOR(MethodActor.class, Class.class, null),
         INVOCATION_STUB(false, MethodActor.class, InvocationStub.class, null),
+        REFLECTION_STUB(false, MethodActor.class, InvocationStub.class, null),
         RUNTIME_VISIBLE_PARAMETER_ANNOTATION_BYTES(MethodActor.class, byte[].class, MethodActor.NO_RUNTIME_VISIBLE_PARAMETER_ANNOTATION_BYTES);
 
         public static final List<Property> VALUES = java.util.Arrays.asList(values());